@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/**
+ * @brief Controller -> işçi dağıtım (dispatch) gecikmesi ölçümü.
+ *
+ * Controller'ın bir işçiye "çalış" deyip işçinin bir birim iş yaptığını görene kadar
+ * geçen gidiş-dönüş süresini iki yolda ölçer:
+ *
+ * - suspend : eski yol; vTaskResume(işçi) -> taskYIELD -> vTaskSuspend(işçi)
+ *             (işçi controller ile aynı öncelikte, iş birimini yapıp yield eder; tick
+ *             kesmesi aynı öncelikteki sırayı bozabildiğinden controller, işçi verilen
+ *             birimi tüketene kadar yield eder)
+ * - notify  : yeni yol; xTaskNotifyGive(işçi) -> ulTaskNotifyTake (işçinin onayı)
+ *
+ * Her iki yol da FreeRTOS POSIX port'u üzerinde gerçek görev geçişleri yapar. Sonunda
+ * iş sayaçları dağıtım sayısıyla karşılaştırılır; işçi her dağıtımda tam bir birim iş
+ * yapmamışsa ölçüm geçersizdir ve program 1 ile çıkar.
+ *
+ * Çıktı: her yol için dağıtım başına ortalama süre (us).
+ *
+ * Kullanım: dispatch_bench [dagitim_sayisi]
+ */
+
+#define BENCH_PRIORITY (configMAX_PRIORITIES - 2)
+#define BENCH_STACK    1024
+
+static int rounds = 20000;
+static TaskHandle_t controllerTask = NULL;
+static volatile int suspendPending = 0; // suspend yolunda işçiye verilmiş, henüz yapılmamış iş birimi
+static volatile long suspendWork = 0; // suspend yolunda işçinin yaptığı iş birimi
+static volatile long notifyWork = 0;  // notify yolunda işçinin yaptığı iş birimi
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void vSuspendWorker(void* pvParameters) {
+    (void)pvParameters;
+    for (;;) {
+        if (suspendPending) {
+            suspendPending = 0;
+            suspendWork++;
+        }
+        taskYIELD();
+    }
+}
+
+static void vNotifyWorker(void* pvParameters) {
+    (void)pvParameters;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        notifyWork++;
+        xTaskNotifyGive(controllerTask);
+    }
+}
+
+static void vBenchTask(void* pvParameters) {
+    TaskHandle_t suspendWorker, notifyWorker;
+    (void)pvParameters;
+
+    controllerTask = xTaskGetCurrentTaskHandle();
+
+    xTaskCreate(vSuspendWorker, "susp", BENCH_STACK, NULL, BENCH_PRIORITY, &suspendWorker);
+    vTaskSuspend(suspendWorker);
+    xTaskCreate(vNotifyWorker, "notif", BENCH_STACK, NULL, BENCH_PRIORITY, &notifyWorker);
+
+    // Isınma: her iki işçi de en az bir kez çalışsın
+    suspendPending = 1;
+    vTaskResume(suspendWorker);
+    while (suspendPending) {
+        taskYIELD();
+    }
+    vTaskSuspend(suspendWorker);
+    xTaskNotifyGive(notifyWorker);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    suspendWork = 0;
+    notifyWork = 0;
+
+    double t0 = nowNs();
+    for (int i = 0; i < rounds; i++) {
+        suspendPending = 1;
+        vTaskResume(suspendWorker);
+        while (suspendPending) {
+            taskYIELD();
+        }
+        vTaskSuspend(suspendWorker);
+    }
+    double t1 = nowNs();
+    for (int i = 0; i < rounds; i++) {
+        xTaskNotifyGive(notifyWorker);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+    double t2 = nowNs();
+
+    printf("dagitim sayisi: %d\n", rounds);
+    printf("%-8s %12s %12s\n", "yol", "us/dagitim", "is birimi");
+    printf("%-8s %12.2f %12ld\n", "suspend", (t1 - t0) / rounds / 1e3, suspendWork);
+    printf("%-8s %12.2f %12ld\n", "notify", (t2 - t1) / rounds / 1e3, notifyWork);
+
+    if (suspendWork != rounds || notifyWork != rounds) {
+        printf("Hata: is birimi sayisi dagitim sayisina esit degil (suspend %ld, notify %ld, beklenen %d).\n",
+            suspendWork, notifyWork, rounds);
+        fflush(stdout);
+        exit(1);
+    }
+    fflush(stdout);
+
+    exit(0);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        rounds = atoi(argv[1]);
+    }
+
+    xTaskCreate(vBenchTask, "bench", BENCH_STACK, NULL, BENCH_PRIORITY, NULL);
+    vTaskStartScheduler();
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "kinetic_heap.h"
+#include "task_store.h"
+
+/**
+ * @brief HRRN seçim maliyeti ölçümü: kinetik turnuva ağacı ile doğrusal tarama.
+ *
+ * Sürekli n canlı görev tutulur (varsayılan 100k). Her kararda zaman ilerler, yanıt
+ * oranı en büyük görev seçilip çıkarılır ve yerine o anda gelen yeni bir görev eklenir;
+ * böylece küme boyutu sabit kalırken oranlar her adımda değişir.
+ *
+ * - kinetic : kinetic_heap.c (khMax + khRemove + khInsert)
+ * - scan    : her kararda n görevin oranını karşılaştıran O(n) tarama
+ *
+ * İki yöntem aynı tohumla aynı görev dizisini üretir; her kararda seçilen görevin aynı
+ * olduğu doğrulanır. Görevler simülatördeki gibi task_store arenasında durur (geliş
+ * zamanı ve id soğuk kayıtta). Çıktı: karar başına süre (ns) ve hızlanma oranı.
+ *
+ * Kullanım: hrrn_bench [canli_gorev] [karar_sayisi]
+ */
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t rngState;
+
+/**
+ * @brief xorshift64*: iki yöntem için aynı görev dizisini üreten tekrarlanabilir üreteç.
+ */
+static uint64_t benchRandom(void) {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return rngState * 0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * @brief Görev kaydını now anında (ya da geçmişe yayılmış) gelmiş olarak kurar.
+ *
+ * Süreler 0.1..100 sn arasındadır; oran eğimleri üç büyüklük mertebesi farklılaşır.
+ */
+static void makeTask(SimulationTask* task, int id, SimTime arrival) {
+    memset(task, 0, sizeof(*task));
+    getTaskCold(task)->id = id;
+    getTaskCold(task)->arrivalTime = arrival;
+    task->policyKey = SIM_TICKS_PER_SEC / 10 + (SimTime)(benchRandom() % (100 * SIM_TICKS_PER_SEC)); // toplam süre
+    task->remainingTime = task->policyKey;
+    task->policyIndex = -1;
+}
+
+/**
+ * @brief Başlangıç kümesi: n görev, son 1000 sn içine dağılmış gelişlerle.
+ */
+static void seedTasks(const TaskStore* tasks, int n) {
+    rngState = 0x9E3779B97F4A7C15ull;
+    for (int i = 0; i < n; i++) {
+        makeTask(tsAt(tasks, i), i, -(SimTime)(benchRandom() % (1000 * SIM_TICKS_PER_SEC)));
+    }
+}
+
+/**
+ * @brief Bir sonraki karar anı: 0..1 sn ilerleme.
+ */
+static SimTime advance(SimTime now) {
+    return now + (SimTime)(benchRandom() % (SIM_TICKS_PER_SEC + 1));
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    int decisions = argc > 2 ? atoi(argv[2]) : 5000;
+
+    SimulationTask** live = malloc((size_t)n * sizeof(*live));
+    int* chosen = malloc((size_t)decisions * sizeof(*chosen));
+    if (n <= 0 || decisions <= 0 || !live || !chosen) {
+        printf("Hata: bellek ayrilamadi.\n");
+        return 1;
+    }
+
+    TaskStore tasks;
+    tsInit(&tasks);
+    for (int i = 0; i < n + decisions; i++) {
+        tsAlloc(&tasks);
+    }
+
+    // === kinetic ===
+    KineticHeap heap;
+    khInit(&heap);
+    seedTasks(&tasks, n);
+    for (int i = 0; i < n; i++) {
+        khInsert(&heap, tsAt(&tasks, i));
+    }
+
+    SimTime now = 0;
+    double start = nowNs();
+    for (int d = 0; d < decisions; d++) {
+        now = advance(now);
+        SimulationTask* best = khMax(&heap, now);
+        chosen[d] = getTaskCold(best)->id;
+        khRemove(&heap, best);
+        makeTask(tsAt(&tasks, n + d), n + d, now);
+        khInsert(&heap, tsAt(&tasks, n + d));
+    }
+    double kineticNs = nowNs() - start;
+
+    // === scan ===
+    seedTasks(&tasks, n);
+    for (int i = 0; i < n; i++) {
+        live[i] = tsAt(&tasks, i);
+    }
+
+    now = 0;
+    int mismatches = 0;
+    start = nowNs();
+    for (int d = 0; d < decisions; d++) {
+        now = advance(now);
+        int best = 0;
+        for (int i = 1; i < n; i++) {
+            if (khRatioGreater(live[i], live[best], now)) {
+                best = i;
+            }
+        }
+        mismatches += getTaskCold(live[best])->id != chosen[d];
+        makeTask(tsAt(&tasks, n + d), n + d, now);
+        live[best] = tsAt(&tasks, n + d);
+    }
+    double scanNs = nowNs() - start;
+
+    printf("Canli gorev: %d, karar: %d\n", n, decisions);
+    printf("%-8s %14s %14s\n", "yontem", "toplam(ms)", "ns/karar");
+    printf("%-8s %14.2f %14.1f\n", "kinetic", kineticNs / 1e6, kineticNs / decisions);
+    printf("%-8s %14.2f %14.1f\n", "scan", scanNs / 1e6, scanNs / decisions);
+    printf("Hizlanma: %.1fx, uyusmazlik: %d\n", scanNs / kineticNs, mismatches);
+
+    tsFree(&tasks);
+    free(live);
+    free(chosen);
+    return mismatches != 0;
+}
@@ -0,0 +1,157 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "scheduler.h"
+
+/**
+ * @brief Görev düzeni (layout) karşılaştırma ölçümü.
+ *
+ * 1M görev üzerinde, eski checkGlobalTimeouts/selectNextTask taramalarının yaptığı işi
+ * (aktif + bitmemiş + öncelik eşleşmesi + deadline kontrolü) üç farklı düzende ölçer:
+ *
+ * - legacy : hot/cold ayrımı öncesi tek parça struct (isim + handle dahil; aktiflik handle'dan)
+ * - hot    : scheduler.h'deki sıcak SimulationTask kaydı
+ * - soa    : alan başına yoğun paralel diziler (struct-of-arrays; alan tipleri sıcak kayıttaki gibi)
+ *
+ * Çıktı: her düzen için kayıt boyutu ve görev başına tarama süresi (ns).
+ *
+ * Kullanım: layout_bench [gorev_sayisi] [tekrar]
+ */
+
+// hot/cold ayrımı öncesi SimulationTask ile aynı alanlar ve sıra (56 bayt)
+typedef struct {
+    int id;
+    int arrivalTime;
+    int priority;
+    int burstTime;
+    int remainingTime;
+    int arrivalTimestamp;
+    int hasStarted;
+    int deadline;
+    char name[16];
+    TaskHandle_t handle;
+} LegacyTask;
+
+static double nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Tarama sonucu; derleyicinin döngüleri atmasını engellemek için toplanır
+static volatile long sink;
+
+static long scanLegacy(const LegacyTask* t, int n, int now) {
+    long hits = 0;
+    for (int p = 0; p < 6; p++) {
+        for (int i = 0; i < n; i++) {
+            if (t[i].handle != NULL && t[i].remainingTime > 0 &&
+                t[i].priority == p && now >= t[i].deadline) {
+                hits++;
+            }
+        }
+    }
+    return hits;
+}
+
+static long scanHot(const SimulationTask* t, int n, SimTime now) {
+    long hits = 0;
+    for (int p = 0; p < 6; p++) {
+        for (int i = 0; i < n; i++) {
+            if (t[i].state == TASK_STATE_READY && t[i].remainingTime > 0 &&
+                t[i].priority == p && now >= t[i].deadline) {
+                hits++;
+            }
+        }
+    }
+    return hits;
+}
+
+static long scanSoa(const unsigned char* state, const SimTime* remaining, const int16_t* priority,
+    const SimTime* deadline, int n, SimTime now) {
+    long hits = 0;
+    for (int p = 0; p < 6; p++) {
+        for (int i = 0; i < n; i++) {
+            if (state[i] == TASK_STATE_READY && remaining[i] > 0 &&
+                priority[i] == p && now >= deadline[i]) {
+                hits++;
+            }
+        }
+    }
+    return hits;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int reps = argc > 2 ? atoi(argv[2]) : 10;
+    int now = 500;
+
+    LegacyTask* legacy = calloc(n, sizeof(LegacyTask));
+    SimulationTask* hot = calloc(n, sizeof(SimulationTask));
+    unsigned char* state = malloc(n);
+    SimTime* remaining = malloc(n * sizeof(SimTime));
+    int16_t* priority = malloc(n * sizeof(int16_t));
+    SimTime* deadline = malloc(n * sizeof(SimTime));
+    if (!legacy || !hot || !state || !remaining || !priority || !deadline) {
+        printf("Hata: bellek ayrilamadi.\n");
+        return 1;
+    }
+
+    srand(19);
+    for (int i = 0; i < n; i++) {
+        int st = (rand() % 4 == 0) ? TASK_STATE_FINISHED : TASK_STATE_READY;
+        int rem = rand() % 8;
+        int pr = rand() % 6;
+        int dl = rand() % 1000;
+
+        legacy[i].id = i;
+        legacy[i].handle = st == TASK_STATE_READY ? (TaskHandle_t)&legacy[i] : NULL;
+        legacy[i].remainingTime = rem;
+        legacy[i].priority = pr;
+        legacy[i].deadline = dl;
+        strcpy(legacy[i].name, "proses");
+
+        hot[i].state = (unsigned char)st;
+        hot[i].remainingTime = rem;
+        hot[i].priority = pr;
+        hot[i].deadline = dl;
+
+        state[i] = (unsigned char)st;
+        remaining[i] = rem;
+        priority[i] = (int16_t)pr;
+        deadline[i] = dl;
+    }
+
+    double best[3] = { 1e300, 1e300, 1e300 };
+    for (int r = 0; r < reps; r++) {
+        double t0 = nowNs();
+        sink += scanLegacy(legacy, n, now);
+        double t1 = nowNs();
+        sink += scanHot(hot, n, now);
+        double t2 = nowNs();
+        sink += scanSoa(state, remaining, priority, deadline, n, now);
+        double t3 = nowNs();
+
+        if (t1 - t0 < best[0]) best[0] = t1 - t0;
+        if (t2 - t1 < best[1]) best[1] = t2 - t1;
+        if (t3 - t2 < best[2]) best[2] = t3 - t2;
+    }
+
+    // Tarama 6 öncelik geçişi yapar (eski selectNextTask gibi)
+    double perTask = 6.0 * n;
+    printf("Gorev sayisi: %d, tekrar: %d (en iyi sure)\n", n, reps);
+    printf("%-8s %12s %14s %16s\n", "duzen", "kayit(bayt)", "tarama(ms)", "ns/gorev/gecis");
+    printf("%-8s %12zu %14.2f %16.3f\n", "legacy", sizeof(LegacyTask), best[0] / 1e6, best[0] / perTask);
+    printf("%-8s %12zu %14.2f %16.3f\n", "hot", sizeof(SimulationTask), best[1] / 1e6, best[1] / perTask);
+    printf("%-8s %12zu %14.2f %16.3f\n", "soa",
+        sizeof(unsigned char) + sizeof(int16_t) + 2 * sizeof(SimTime), best[2] / 1e6, best[2] / perTask);
+
+    free(legacy);
+    free(hot);
+    free(state);
+    free(remaining);
+    free(priority);
+    free(deadline);
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "deadline_heap.h"
+
+/**
+ * @brief a görevi b'den önce mi dolar? (deadline, eşitse id)
+ */
+static int dhLess(const SimulationTask* a, const SimulationTask* b) {
+    if (a->deadline != b->deadline) {
+        return a->deadline < b->deadline;
+    }
+    return getTaskCold(a)->id < getTaskCold(b)->id;
+}
+
+/**
+ * @brief i konumuna görevi yazar ve görevin heapIndex alanını günceller.
+ */
+static void dhPlace(DeadlineHeap* heap, int i, SimulationTask* task) {
+    heap->items[i] = task;
+    task->heapIndex = i;
+}
+
+/**
+ * @brief i konumundaki görevi köke doğru kaydırır.
+ */
+static void dhSiftUp(DeadlineHeap* heap, int i) {
+    SimulationTask* task = heap->items[i];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!dhLess(task, heap->items[parent])) {
+            break;
+        }
+        dhPlace(heap, i, heap->items[parent]);
+        i = parent;
+    }
+    dhPlace(heap, i, task);
+}
+
+/**
+ * @brief i konumundaki görevi yapraklara doğru kaydırır.
+ */
+static void dhSiftDown(DeadlineHeap* heap, int i) {
+    SimulationTask* task = heap->items[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= heap->size) {
+            break;
+        }
+        if (child + 1 < heap->size && dhLess(heap->items[child + 1], heap->items[child])) {
+            child++;
+        }
+        if (!dhLess(heap->items[child], task)) {
+            break;
+        }
+        dhPlace(heap, i, heap->items[child]);
+        i = child;
+    }
+    dhPlace(heap, i, task);
+}
+
+/**
+ * @brief Boş bir heap hazırlar.
+ */
+void dhInit(DeadlineHeap* heap) {
+    heap->items = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+}
+
+/**
+ * @brief Görevi heap'e ekler; dizi dolarsa kapasite iki katına çıkarılır.
+ */
+void dhPush(DeadlineHeap* heap, SimulationTask* task) {
+    if (heap->size == heap->capacity) {
+        int newCapacity = heap->capacity ? heap->capacity * 2 : 64;
+        SimulationTask** items = realloc(heap->items, (size_t)newCapacity * sizeof(*items));
+        if (!items) {
+            printf("Hata: deadline heap icin bellek ayrilamadi.\n");
+            exit(1);
+        }
+        heap->items = items;
+        heap->capacity = newCapacity;
+    }
+
+    dhPlace(heap, heap->size, task);
+    heap->size++;
+    dhSiftUp(heap, heap->size - 1);
+}
+
+/**
+ * @brief Görevi heap'ten çıkarır; yerine son eleman konup uygun yöne kaydırılır.
+ */
+void dhRemove(DeadlineHeap* heap, SimulationTask* task) {
+    int i = task->heapIndex;
+    if (i < 0) {
+        return;
+    }
+
+    task->heapIndex = -1;
+    heap->size--;
+
+    if (i == heap->size) {
+        return;
+    }
+
+    dhPlace(heap, i, heap->items[heap->size]);
+    dhUpdate(heap, heap->items[i]);
+}
+
+/**
+ * @brief Değişen anahtara göre görevi yukarı ya da aşağı kaydırır.
+ */
+void dhUpdate(DeadlineHeap* heap, SimulationTask* task) {
+    int i = task->heapIndex;
+    if (i < 0) {
+        return;
+    }
+
+    if (i > 0 && dhLess(task, heap->items[(i - 1) / 2])) {
+        dhSiftUp(heap, i);
+    }
+    else {
+        dhSiftDown(heap, i);
+    }
+}
+
+/**
+ * @brief En erken deadline'lı görev.
+ */
+SimulationTask* dhPeek(const DeadlineHeap* heap) {
+    return heap->size > 0 ? heap->items[0] : NULL;
+}
@@ -0,0 +1,47 @@
+#ifndef DEADLINE_HEAP_H
+#define DEADLINE_HEAP_H
+
+#include "scheduler.h"
+
+/**
+ * @brief Görevleri zaman aşımı eşiğine (deadline) göre tutan indeksli min-heap.
+ *
+ * Anahtar (deadline, id) çiftidir; aynı anda dolan görevler id sırasıyla çıkar
+ * (eski tam taramadaki log sırasıyla aynı). Her görevin heap içindeki konumu
+ * SimulationTask.heapIndex alanında tutulur; bu sayede deadline değişince
+ * (ertelenme/öne çekilme) görev O(log n) yerinde güncellenir, silme de O(log n)'dir.
+ */
+typedef struct {
+    SimulationTask** items;  // Heap dizisi (items[0] en erken deadline)
+    int size;                // Heap'teki görev sayısı
+    int capacity;            // items dizisinin kapasitesi
+} DeadlineHeap;
+
+/**
+ * @brief Boş bir heap hazırlar.
+ */
+void dhInit(DeadlineHeap* heap);
+
+/**
+ * @brief Görevi heap'e ekler (task->deadline anahtarıyla).
+ */
+void dhPush(DeadlineHeap* heap, SimulationTask* task);
+
+/**
+ * @brief Görevi heap'ten çıkarır (heap'te değilse bir şey yapmaz).
+ */
+void dhRemove(DeadlineHeap* heap, SimulationTask* task);
+
+/**
+ * @brief task->deadline değiştikten sonra görevin heap içindeki yerini düzeltir.
+ *
+ * Hem anahtar küçülmesini hem büyümesini destekler.
+ */
+void dhUpdate(DeadlineHeap* heap, SimulationTask* task);
+
+/**
+ * @brief En erken deadline'a sahip görevi döndürür (heap boşsa NULL).
+ */
+SimulationTask* dhPeek(const DeadlineHeap* heap);
+
+#endif
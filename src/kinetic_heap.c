@@ -0,0 +1,201 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "kinetic_heap.h"
+
+#define KH_INVALID INT64_MIN // Yeniden hesaplanması gereken iç düğüm
+
+/**
+ * @brief Oranın paydası (policyKey'deki toplam süre); 0 ya da negatifse 1 tick sayılır.
+ */
+static int64_t khBurst(const SimulationTask* task) {
+    return task->policyKey > 0 ? task->policyKey : 1;
+}
+
+/**
+ * @brief a'nın now anındaki oranı b'ninkinden büyük mü (bkz. kinetic_heap.h).
+ *
+ * (now - a + b_a) / b_a > (now - b + b_b) / b_b, paydalar çapraz çarpılarak kesin karşılaştırılır.
+ */
+int khRatioGreater(const SimulationTask* a, const SimulationTask* b, SimTime now) {
+    int64_t ba = khBurst(a);
+    int64_t bb = khBurst(b);
+    __int128 lhs = (__int128)(now - getTaskCold(a)->arrivalTime + ba) * bb;
+    __int128 rhs = (__int128)(now - getTaskCold(b)->arrivalTime + bb) * ba;
+    if (lhs != rhs) {
+        return lhs > rhs;
+    }
+    return taskArrivedBefore(a, b);
+}
+
+/**
+ * @brief Kaybeden l'nin kazanan w'yi ilk geçtiği an (geçemezse SIM_TIME_NEVER).
+ *
+ * Fark D(t) = (t - a_l + b_l) * b_w - (t - a_w + b_w) * b_l, t'ye göre (b_w - b_l) eğimli
+ * bir doğrudur. b_l >= b_w ise l'nin oranı w'ninkinden hızlı artmaz, sıra hiç bozulmaz;
+ * değilse D(t) >= 0 olan ilk tamsayı t bulunur. Orada eşitlik varsa ve eşitlik kuralı
+ * w'den yanaysa sıra bir tick sonra bozulur.
+ */
+static SimTime khCrossing(const SimulationTask* w, const SimulationTask* l) {
+    int64_t bw = khBurst(w);
+    int64_t bl = khBurst(l);
+    if (bl >= bw) {
+        return SIM_TIME_NEVER;
+    }
+
+    int64_t slope = bw - bl;
+    __int128 k = (__int128)(getTaskCold(l)->arrivalTime - bl) * bw - (__int128)(getTaskCold(w)->arrivalTime - bw) * bl;
+    __int128 t = k / slope;
+    if (k % slope != 0 && k > 0) {
+        t++;
+    }
+    if (k == t * slope && taskArrivedBefore(w, l)) {
+        t++;
+    }
+    if (t >= (__int128)SIM_TIME_NEVER) {
+        return SIM_TIME_NEVER;
+    }
+    if (t <= (__int128)INT64_MIN + 1) {
+        return INT64_MIN + 1;
+    }
+    return (SimTime)t;
+}
+
+/**
+ * @brief Yaprağın köke giden yolundaki iç düğümleri geçersiz kılar.
+ */
+static void khInvalidatePath(KineticHeap* heap, int node) {
+    for (node >>= 1; node > 0 && heap->validUntil[node] != KH_INVALID; node >>= 1) {
+        heap->validUntil[node] = KH_INVALID;
+    }
+}
+
+/**
+ * @brief Süresi dolmuş iç düğümleri now anına göre yeniden hesaplar.
+ *
+ * Düğümün geçerlilik süresi çocuklarınınkini aşmadığından geçerli bir düğümün altı da
+ * geçerlidir; iniş yalnızca süresi dolmuş dallara yapılır.
+ */
+static void khRefresh(KineticHeap* heap, int node, SimTime now) {
+    if (node >= heap->capacity || heap->validUntil[node] > now) {
+        return;
+    }
+
+    int left = 2 * node;
+    int right = left + 1;
+    khRefresh(heap, left, now);
+    khRefresh(heap, right, now);
+
+    SimulationTask* a = heap->winner[left];
+    SimulationTask* b = heap->winner[right];
+    SimTime until = heap->validUntil[left] < heap->validUntil[right] ? heap->validUntil[left] : heap->validUntil[right];
+
+    if (a == NULL || b == NULL) {
+        heap->winner[node] = a != NULL ? a : b;
+    }
+    else {
+        SimulationTask* w = khRatioGreater(a, b, now) ? a : b;
+        SimTime crossing = khCrossing(w, w == a ? b : a);
+        heap->winner[node] = w;
+        if (crossing < until) {
+            until = crossing;
+        }
+    }
+    heap->validUntil[node] = until;
+}
+
+/**
+ * @brief Yaprak sayısını ikiye katlar; yapraklar taşınır, iç düğümler geçersiz başlar.
+ */
+static void khGrow(KineticHeap* heap) {
+    int capacity = heap->capacity ? heap->capacity * 2 : 64;
+    SimulationTask** winner = calloc((size_t)capacity * 2, sizeof(*winner));
+    SimTime* validUntil = malloc((size_t)capacity * 2 * sizeof(*validUntil));
+    int* freeSlots = malloc((size_t)capacity * sizeof(*freeSlots));
+    if (!winner || !validUntil || !freeSlots) {
+        printf("Hata: kinetik agac icin bellek ayrilamadi.\n");
+        exit(1);
+    }
+
+    for (int node = 1; node < capacity; node++) {
+        validUntil[node] = KH_INVALID;
+    }
+    for (int node = capacity; node < 2 * capacity; node++) {
+        validUntil[node] = SIM_TIME_NEVER;
+    }
+    for (int slot = 0; slot < heap->used; slot++) {
+        winner[capacity + slot] = heap->winner[heap->capacity + slot];
+    }
+    for (int i = 0; i < heap->freeCount; i++) {
+        freeSlots[i] = heap->freeSlots[i];
+    }
+
+    free(heap->winner);
+    free(heap->validUntil);
+    free(heap->freeSlots);
+    heap->winner = winner;
+    heap->validUntil = validUntil;
+    heap->freeSlots = freeSlots;
+    heap->capacity = capacity;
+}
+
+/**
+ * @brief Boş bir ağaç hazırlar.
+ */
+void khInit(KineticHeap* heap) {
+    heap->winner = NULL;
+    heap->validUntil = NULL;
+    heap->freeSlots = NULL;
+    heap->freeCount = 0;
+    heap->used = 0;
+    heap->capacity = 0;
+    heap->count = 0;
+}
+
+/**
+ * @brief Görevi boş bir yaprağa yerleştirir; O(log n).
+ */
+void khInsert(KineticHeap* heap, SimulationTask* task) {
+    int slot;
+
+    if (heap->freeCount > 0) {
+        slot = heap->freeSlots[--heap->freeCount];
+    }
+    else {
+        if (heap->used == heap->capacity) {
+            khGrow(heap);
+        }
+        slot = heap->used++;
+    }
+
+    task->policyIndex = slot;
+    heap->winner[heap->capacity + slot] = task;
+    heap->count++;
+    khInvalidatePath(heap, heap->capacity + slot);
+}
+
+/**
+ * @brief Görevin yaprağını boşaltır; O(log n).
+ */
+void khRemove(KineticHeap* heap, SimulationTask* task) {
+    int slot = task->policyIndex;
+    if (slot < 0) {
+        return;
+    }
+
+    heap->winner[heap->capacity + slot] = NULL;
+    heap->freeSlots[heap->freeCount++] = slot;
+    heap->count--;
+    task->policyIndex = -1;
+    khInvalidatePath(heap, heap->capacity + slot);
+}
+
+/**
+ * @brief now anında oranı en büyük görev (bkz. kinetic_heap.h).
+ */
+SimulationTask* khMax(KineticHeap* heap, SimTime now) {
+    if (heap->count == 0) {
+        return NULL;
+    }
+    khRefresh(heap, 1, now);
+    return heap->winner[1];
+}
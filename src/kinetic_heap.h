@@ -0,0 +1,59 @@
+#ifndef KINETIC_HEAP_H
+#define KINETIC_HEAP_H
+
+#include "scheduler.h"
+
+/**
+ * @brief Yanıt oranı (response ratio) en büyük görevi veren kinetik turnuva ağacı.
+ *
+ * Bekleyen görevin HRRN oranı R(t) = (t - arrivalTime + b) / b, zamana göre eğimi 1/b
+ * olan bir doğrudur (b: görevin toplam süresi; ağaçtayken policyKey alanında tutulur).
+ * Oranlar her tick değişse de iki görevin sırası ancak doğruları kesiştiğinde değişir. Ağacın her iç düğümü iki çocuğunun
+ * kazananını ve bu sonucun geçerli kaldığı zamanı (sertifika: kaybedenin kazananı
+ * geçeceği an ile çocukların geçerlilik sürelerinin en küçüğü) tutar.
+ *
+ * Sorgu zamanı hiç geri gitmediği için sertifikalar tembel işlenir: sorguda yalnızca
+ * süresi dolmuş düğümler yeniden hesaplanır; geçerli kökte sorgu O(1)'dir. Ekleme ve
+ * silme yalnızca yaprağın köke giden yolunu geçersiz kılar (O(log n)). Karşılaştırmalar
+ * 128 bit tamsayıyla kesin yapılır; eşit oranda önce erken gelen, sonra küçük id kazanır.
+ *
+ * Görevin yaprak konumu SimulationTask.policyIndex alanında tutulur.
+ */
+typedef struct {
+    SimulationTask** winner;  // Düğüm başına kazanan (1..2*capacity-1; yapraklar capacity'den başlar)
+    SimTime* validUntil;      // İç düğüm sonucunun geçerli olduğu son sorgu zamanından sonraki an
+    int* freeSlots;           // Boş yaprak yığını
+    int freeCount;
+    int used;                 // Şimdiye dek verilen yaprak sayısı
+    int capacity;             // Yaprak sayısı (2'nin kuvveti)
+    int count;                // Ağaçtaki görev sayısı
+} KineticHeap;
+
+/**
+ * @brief Boş bir ağaç hazırlar.
+ */
+void khInit(KineticHeap* heap);
+
+/**
+ * @brief Bekleyen görevi ekler (policyKey = toplam süre, > 0 olmalı).
+ */
+void khInsert(KineticHeap* heap, SimulationTask* task);
+
+/**
+ * @brief Görevi ağaçtan çıkarır (ağaçta değilse bir şey yapmaz).
+ */
+void khRemove(KineticHeap* heap, SimulationTask* task);
+
+/**
+ * @brief now anında yanıt oranı en büyük görevi döndürür (ağaç boşsa NULL).
+ *
+ * now ardışık çağrılarda azalmamalıdır.
+ */
+SimulationTask* khMax(KineticHeap* heap, SimTime now);
+
+/**
+ * @brief a görevinin now anındaki yanıt oranı b'ninkinden büyük mü? (eşitlikte erken gelen, sonra küçük id)
+ */
+int khRatioGreater(const SimulationTask* a, const SimulationTask* b, SimTime now);
+
+#endif
@@ -1,20 +1,160 @@
 ﻿#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "scheduler.h"
+#include "sweep.h"
+#include "policy.h"
 
 /**
  * @brief Programın giriş noktası.
  *
- * - stdout buffering kapatılır: Log/printf çıktıları anlık (gecikmesiz) görünür.
+ * - stdout tam tamponlu yapılır; log satırları ayrı bir yazıcı iş parçacığından toplu
+ *   halde basılır (bkz. task_log.h).
+ * - Komut satırı seçenekleri işlenir:
+ *     --virtual (-v) : sanal zaman kipi (quantum başına gerçek bekleme yapılmaz)
+ *     --stream (-s)  : akış kipi (gelişler dosyadan tembel okunur; dosya sıralı olmalı)
+ *     --lightweight (-l): hafif proses kipi (prosesler yalnızca kayıt; işçi sadece çalışırken bağlanır)
+ *     --cores (-c) <n>: simüle edilen çekirdek sayısı (1..64, varsayılan 1)
+ *     --policy (-p) <ad>: zamanlama politikası (varsayılan "mlfq", bkz. policy.h)
+ *     --cfs-latency <sn>, --cfs-min-granularity <sn>:
+ *                      cfs politikasının gecikme hedefi (varsayılan 6) ve en küçük dilimi (0.75)
+ *     --seed <n>     : lottery politikasının çekiliş tohumu (varsayılan 1)
+ *     --quantum (-q) <sn>: quantum süresi, kesirli olabilir (or. 0.25; varsayılan 1)
+ *     --boost <sn>   : mlfq politikasında her sn saniyede seviye 1..5'i seviye 1'e toplar
+ *                      (varsayılan kapalı)
+ *     --sweep-timeout/--sweep-quantum/--sweep-levels <a,b,..>:
+ *                      (süreler saniye, kesirli olabilir; seviyeler tamsayı)
+ *                      parametre taraması; ızgaradaki her yapılandırma sanal zamanda paralel
+ *                      çalıştırılır ve bir sonuç satırı basılır (FreeRTOS başlatılmaz).
+ *                      Diğer seçenekler (politika, çekirdek, yükseltme, akış...) tüm
+ *                      yapılandırmalara uygulanır; --quantum verilip --sweep-quantum
+ *                      verilmezse taramanın quantum'u olur. --sweep-levels yalnızca mlfq
+ *                      ile, --event-log hiç kullanılamaz (tarama log basmaz)
+ *     --log-drop     : log halkası dolarsa beklemek yerine kaydı at ve say
+ *     --event-log <f>: log satırları yerine ikili olay logunu f'ye yaz (tools/event_decode ile okunur)
+ *     <dosya>        : görev listesi dosyası (verilmezse "giris.txt"; metin ya da ikili iz)
  * - Scheduler için gerekli başlangıç işlemleri yapılır (görevlerin yüklenmesi vb.).
  * - FreeRTOS scheduler başlatılır; bu noktadan sonra kontrol RTOS'a geçer.
  *
  * @return Normal şartlarda scheduler başladığı için buraya dönmez.
  */
-int main(void) {
-    setvbuf(stdout, NULL, _IONBF, 0); // stdout tamponlamasını kapat (printf çıktıları anında gelsin)
+int main(int argc, char** argv) {
+    setvbuf(stdout, NULL, _IOFBF, 1 << 16); // stdout tam tamponlu; log yazıcısı toplu yazıp kendisi boşaltır
 
-    vInitScheduler();   // Görevleri/parametreleri hazırla (ör. giris.txt yükleme)
+    const char* inputPath = NULL;
+    LogOverflowPolicy overflowPolicy = LOG_OVERFLOW_BLOCK;
+    SweepGrid grid = { .timeoutWindowCount = 0, .quantumCount = 0, .levelCount = 0 };
+    int sweepMode = 0;
+    const char* policyName = "mlfq";  // --policy (--sweep-levels yalnızca mlfq'da geçerli)
+    const char* eventLogPath = NULL;  // --event-log (taramada reddedilir)
+    SimTime quantumTicks = 0;         // --quantum (taramada varsayılan quantum olur)
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--virtual") == 0 || strcmp(argv[i], "-v") == 0) {
+            vSchedulerSetVirtualTime(1);
+        }
+        else if (strcmp(argv[i], "--stream") == 0 || strcmp(argv[i], "-s") == 0) {
+            vSchedulerSetStreaming(1);
+        }
+        else if (strcmp(argv[i], "--lightweight") == 0 || strcmp(argv[i], "-l") == 0) {
+            vSchedulerSetLightweight(1);
+        }
+        else if ((strcmp(argv[i], "--cores") == 0 || strcmp(argv[i], "-c") == 0) && i + 1 < argc) {
+            vSchedulerSetCores(atoi(argv[++i]));
+        }
+        else if ((strcmp(argv[i], "--policy") == 0 || strcmp(argv[i], "-p") == 0) && i + 1 < argc) {
+            policyName = argv[++i];
+            vSchedulerSetPolicy(policyName);
+        }
+        else if ((strcmp(argv[i], "--cfs-latency") == 0 || strcmp(argv[i], "--cfs-min-granularity") == 0) && i + 1 < argc) {
+            const char* option = argv[i];
+            const char* text = argv[++i];
+            SimTime ticks;
+            const char* end = simParseSeconds(text, text + strlen(text), &ticks);
+            if (end == NULL || *end != '\0' || ticks <= 0) {
+                printf("Hata: '%s' gecerli bir sure degil (or. 0.75).\n", text);
+                return 1;
+            }
+            if (strcmp(option, "--cfs-latency") == 0) {
+                cfsSetLatency(ticks);
+            }
+            else {
+                cfsSetMinGranularity(ticks);
+            }
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            lotterySetSeed(strtoull(argv[++i], NULL, 10));
+        }
+        else if ((strcmp(argv[i], "--quantum") == 0 || strcmp(argv[i], "-q") == 0) && i + 1 < argc) {
+            const char* text = argv[++i];
+            SimTime ticks;
+            const char* end = simParseSeconds(text, text + strlen(text), &ticks);
+            if (end == NULL || *end != '\0' || ticks <= 0) {
+                printf("Hata: '%s' gecerli bir quantum degil (or. 0.25).\n", text);
+                return 1;
+            }
+            vSchedulerSetQuantum(ticks);
+            quantumTicks = ticks;
+        }
+        else if (strcmp(argv[i], "--boost") == 0 && i + 1 < argc) {
+            const char* text = argv[++i];
+            SimTime ticks;
+            const char* end = simParseSeconds(text, text + strlen(text), &ticks);
+            if (end == NULL || *end != '\0' || ticks <= 0) {
+                printf("Hata: '%s' gecerli bir sure degil (or. 5).\n", text);
+                return 1;
+            }
+            mlfqSetBoostPeriod(ticks);
+        }
+        else if (strcmp(argv[i], "--sweep-timeout") == 0 && i + 1 < argc) {
+            grid.timeoutWindowCount = sweepParseTimeList(argv[++i], grid.timeoutWindows);
+            sweepMode = 1;
+        }
+        else if (strcmp(argv[i], "--sweep-quantum") == 0 && i + 1 < argc) {
+            grid.quantumCount = sweepParseTimeList(argv[++i], grid.quanta);
+            sweepMode = 1;
+        }
+        else if (strcmp(argv[i], "--sweep-levels") == 0 && i + 1 < argc) {
+            grid.levelCount = sweepParseList(argv[++i], grid.levels);
+            sweepMode = 1;
+        }
+        else if (strcmp(argv[i], "--log-drop") == 0) {
+            overflowPolicy = LOG_OVERFLOW_DROP;
+        }
+        else if (strcmp(argv[i], "--event-log") == 0 && i + 1 < argc) {
+            eventLogPath = argv[++i];
+        }
+        else if (argv[i][0] != '-' && inputPath == NULL) {
+            inputPath = argv[i];
+        }
+        else {
+            printf("Kullanim: %s [--virtual] [--stream] [--lightweight] [--cores N] [--policy ad] [--cfs-latency sn] [--cfs-min-granularity sn] [--seed n] [--quantum sn] [--boost sn] [--sweep-timeout L] [--sweep-quantum L] [--sweep-levels L] [--log-drop] [--event-log dosya] [giris_dosyasi]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (sweepMode) {
+        // Seviye sayısı yalnızca MLFQ'da anlamlıdır; taramanın çalıştırmaları log basmaz
+        if (grid.levelCount > 0 && strcmp(policyName, "mlfq") != 0) {
+            printf("Hata: --sweep-levels yalnizca mlfq politikasiyla kullanilabilir.\n");
+            return 1;
+        }
+        if (eventLogPath != NULL) {
+            printf("Hata: --event-log parametre taramasiyla (--sweep-*) kullanilamaz.\n");
+            return 1;
+        }
+        if (grid.quantumCount == 0 && quantumTicks > 0) {
+            grid.quanta[grid.quantumCount++] = quantumTicks;
+        }
+        runSweep(inputPath, &grid);
+        return 0;
+    }
+
+    if (eventLogPath != NULL) {
+        logSetEventFile(eventLogPath);
+    }
+    logInit(overflowPolicy);          // Log yazıcı iş parçacığını başlat
+    vInitScheduler(inputPath);   // Görevleri/parametreleri hazırla (ör. giris.txt yükleme)
     vSchedulerStart();  // Scheduler görevini oluştur ve FreeRTOS'u başlat
 
     return 0; // Teoride RTOS çalışırken buraya dönülmez; güvenlik için mevcut.
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <string.h>
+#include "policy.h"
+
+// Kayıtlı politikalar; ilk eleman varsayılandır
+static const SchedPolicy* const POLICIES[] = {
+    &mlfqPolicy,
+    &edfPolicy,
+    &cfsPolicy,
+    &srtfPolicy,
+    &sjfPolicy,
+    &lotteryPolicy,
+    &stridePolicy,
+    &hrrnPolicy,
+};
+
+#define POLICY_COUNT (int)(sizeof(POLICIES) / sizeof(POLICIES[0]))
+
+// Öncelik -> bilet (pay) tablosu; her kademe payı yarıya indirir
+static const int POLICY_TICKETS[POLICY_SHARE_CLASSES] = { 32, 16, 8, 4, 2, 1 };
+
+/**
+ * @brief Önceliğin pay sınıfı (bkz. policy.h).
+ */
+int policyShareClass(int priority) {
+    if (priority < 0) {
+        return 0;
+    }
+    return priority < POLICY_SHARE_CLASSES ? priority : POLICY_SHARE_CLASSES - 1;
+}
+
+/**
+ * @brief Önceliğin bilet sayısı (bkz. policy.h).
+ */
+int policyTickets(int priority) {
+    return POLICY_TICKETS[policyShareClass(priority)];
+}
+
+/**
+ * @brief Adı verilen politikayı döndürür (bkz. policy.h).
+ */
+const SchedPolicy* policyFind(const char* name) {
+    for (int i = 0; i < POLICY_COUNT; i++) {
+        if (strcmp(POLICIES[i]->name, name) == 0) {
+            return POLICIES[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Politika listesini basar (bkz. policy.h).
+ */
+void policyPrintList(void) {
+    printf("Politikalar:\n");
+    for (int i = 0; i < POLICY_COUNT; i++) {
+        printf("  %-8s %s%s\n", POLICIES[i]->name, POLICIES[i]->description, i == 0 ? " (varsayilan)" : "");
+    }
+}
@@ -0,0 +1,156 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include "scheduler.h"
+
+#define POLICY_SHARE_CLASSES 6 // Orantılı pay politikalarındaki sınıf (öncelik) sayısı
+#define POLICY_STOLEN (-2)     // policyIndex: steal'in çıkardığı, hırsızda bu quantum'da çalışacak görev
+
+/**
+ * @brief Zamanlama politikası arayüzü (controller'ın çağırdığı kancalar).
+ *
+ * Controller (vSchedulerTask) gelişleri, zaman aşımlarını, quantum'u, logları ve
+ * istatistikleri yürütür; hangi görevin çalışacağına ve quantum sonunda görevin ne
+ * olacağına politika karar verir. Her politika çekirdek başına kendi hazır kümesini
+ * (ready set) kendi modülündeki statik durumda, kendine uygun veri yapısıyla tutar.
+ * Yeni politika eklemek için kancaları yazıp policy.c'deki tabloya eklemek yeterlidir;
+ * controller döngüsüne dokunulmaz.
+ *
+ * Kancalar yalnızca controller görevinden çağrılır; kilit gerekmez.
+ */
+typedef struct {
+    const char* name;        // Komut satırındaki adı (--policy)
+    const char* description; // Kullanım metnindeki kısa açıklama
+
+    /**
+     * @brief Tüm çekirdeklerin hazır kümelerini boşaltır (simülasyon başında bir kez).
+     */
+    void (*init)(int cores);
+
+    /**
+     * @brief Görev core çekirdeğinin hazır kümesine girer.
+     *
+     * Hem sisteme ilk gelişte hem de başka çekirdekten çalınan görev için çağrılır.
+     */
+    void (*on_arrival)(int core, SimulationTask* task);
+
+    /**
+     * @brief Bu quantum'da core çekirdeğinde çalışacak görevi seçer (yoksa NULL).
+     *
+     * Seçilen görev hazır kümede kalır; çıkarılması on_complete/on_timeout ile olur.
+     */
+    SimulationTask* (*pick_next)(int core);
+
+    /**
+     * @brief Görevin bu seçimde çalışacağı en uzun süre (NULL ise genel quantum).
+     *
+     * Controller dilimi ayrıca görevin kalan süresiyle sınırlar.
+     */
+    SimTime (*time_slice)(int core, const SimulationTask* task);
+
+    /**
+     * @brief Quantum sonunda çalışan her görev için, tamamlanma/quantum sonu kararından önce
+     *        çağrılır (NULL olabilir); politikanın hizmet muhasebesi içindir.
+     *
+     * @param ran Görevin bu quantum'da çalıştığı süre (tick)
+     */
+    void (*account)(int core, SimulationTask* task, SimTime ran);
+
+    /**
+     * @brief Görev quantum'unu bitirdi ama işi sürüyor (remainingTime > 0).
+     *
+     * @param ran Görevin bu quantum'da çalıştığı süre (tick)
+     * @return Görev geri planlandıysa (örn. seviyesi düştüyse; "askıda" loglanır) 1, aksi halde 0
+     */
+    int (*on_quantum_expired)(int core, SimulationTask* task, SimTime ran);
+
+    /**
+     * @brief Görev tamamlandı; hazır kümeden çıkarılır (kümede değilse bir şey yapmaz).
+     */
+    void (*on_complete)(int core, SimulationTask* task);
+
+    /**
+     * @brief Görev zaman aşımıyla düştü; hazır kümeden çıkarılır (kümede değilse bir şey yapmaz).
+     */
+    void (*on_timeout)(int core, SimulationTask* task);
+
+    /**
+     * @brief İş çalma: victim çekirdeğinden skip dışındaki bir görevi çıkarıp döndürür (yoksa NULL).
+     *
+     * Çıkarılan görev controller tarafından hırsız çekirdekte on_arrival ile kümeye girer.
+     * Görev o quantum'da hırsızda çalışır; non-preemptive politikalar onu policyIndex =
+     * POLICY_STOLEN ile işaretleyip on_arrival'da hırsızın çalışan görevi yapar.
+     */
+    SimulationTask* (*steal)(int victim, const SimulationTask* skip);
+
+    /**
+     * @brief core çekirdeğinin hazır kümesindeki görev sayısı (yük dengeleme ölçüsü).
+     */
+    int (*load)(int core);
+
+    /**
+     * @brief Özet rapora politikaya özgü satırları ekler (NULL olabilir).
+     */
+    void (*report)(void);
+} SchedPolicy;
+
+extern const SchedPolicy mlfqPolicy; // Varsayılan: 6 seviyeli MLFQ, seviye 3 Round-Robin
+extern const SchedPolicy edfPolicy;  // Earliest-Deadline-First (mutlak deadline, indeksli heap)
+extern const SchedPolicy cfsPolicy;  // Completely-Fair benzeri: ağırlıklı vruntime, en küçüğü seçilir
+extern const SchedPolicy srtfPolicy; // Shortest-Remaining-Time-First (kalan süreye göre min-heap)
+extern const SchedPolicy sjfPolicy;  // Shortest-Job-First, non-preemptive (aynı heap)
+extern const SchedPolicy lotteryPolicy; // Piyango: öncelik -> bilet, Fenwick ağacıyla çekiliş
+extern const SchedPolicy stridePolicy;  // Stride: öncelik -> bilet, en küçük pass (indeksli heap)
+extern const SchedPolicy hrrnPolicy;    // Highest-Response-Ratio-Next, non-preemptive (kinetik turnuva ağacı)
+
+/**
+ * @brief MLFQ periyodik öncelik yükseltme: her period'da seviye 1..5'teki tüm görevler
+ *        seviye 1'e toplanır (varsayılan 0: kapalı).
+ */
+void mlfqSetBoostPeriod(SimTime period);
+
+/**
+ * @brief MLFQ'nun kullandığı seviye sayısı (2..READY_LEVELS, varsayılan READY_LEVELS).
+ *
+ * Seviye levels - 1 en alt seviyedir (kademe düşürme orada durur), Round-Robin seviyesi
+ * min(3, levels - 1) olur; levels ve üstündeki öncelikler hiç seçilmez. Parametre
+ * taraması (sweep.h) bu ayarla çalışır. Aralık dışında hata basılıp program sonlandırılır.
+ */
+void mlfqSetLevels(int levels);
+
+/**
+ * @brief CFS gecikme hedefi: bir çekirdekteki her hazır görevin bir kez çalıştığı süre (varsayılan 6 sn).
+ */
+void cfsSetLatency(SimTime latency);
+
+/**
+ * @brief CFS en küçük dilim: çok görev olduğunda dilimin inemeyeceği alt sınır (varsayılan 0.75 sn).
+ */
+void cfsSetMinGranularity(SimTime granularity);
+
+/**
+ * @brief Piyango çekilişlerinin tohumu (varsayılan 1); aynı tohum aynı çalıştırmayı verir.
+ */
+void lotterySetSeed(uint64_t seed);
+
+/**
+ * @brief Önceliğin pay sınıfı: 0..POLICY_SHARE_CLASSES-1 aralığına sıkıştırılmış öncelik.
+ */
+int policyShareClass(int priority);
+
+/**
+ * @brief Orantılı pay politikalarında (lottery, stride) önceliğin bilet sayısı (32, 16, ..., 1).
+ */
+int policyTickets(int priority);
+
+/**
+ * @brief Adı verilen politikayı döndürür, yoksa NULL.
+ */
+const SchedPolicy* policyFind(const char* name);
+
+/**
+ * @brief Kayıtlı politikaların adlarını ve açıklamalarını basar (kullanım metni için).
+ */
+void policyPrintList(void);
+
+#endif
@@ -0,0 +1,163 @@
+#include "policy.h"
+#include "task_heap.h"
+
+#define CFS_NICE0_WEIGHT 1024 // Ağırlığı bu olan görevin vruntime'ı gerçek çalışma süresiyle aynı hızda artar
+
+/**
+ * @brief Öncelik -> ağırlık (Linux'un nice tablosundan -5, -3, -1, 1, 3, 5 değerleri).
+ *
+ * Her kademe yaklaşık 1.56 kat daha az CPU payı demektir; aralık dışındaki öncelikler
+ * en yakın uca sıkıştırılır.
+ */
+static const int CFS_WEIGHTS[] = { 3121, 1991, 1277, 820, 526, 335 };
+
+#define CFS_WEIGHT_COUNT (int)(sizeof(CFS_WEIGHTS) / sizeof(CFS_WEIGHTS[0]))
+
+static TaskHeap trees[SIM_MAX_CORES];      // Çekirdek başına, vruntime'a göre sıralı hazır kümesi
+static SimTime minVruntime[SIM_MAX_CORES]; // Çekirdeğin tekdüze artan en küçük vruntime'ı
+static long totalWeight[SIM_MAX_CORES];    // Çekirdekteki hazır görevlerin ağırlık toplamı
+
+static SimTime latency = 6 * SIM_TICKS_PER_SEC;                  // Gecikme hedefi (tick)
+static SimTime minGranularity = 3 * SIM_TICKS_PER_SEC / 4;       // En küçük dilim (tick)
+
+/**
+ * @brief Görevin ağırlığı (önceliğinden).
+ */
+static int cfsWeight(const SimulationTask* task) {
+    int p = task->priority;
+    if (p < 0) {
+        p = 0;
+    }
+    if (p >= CFS_WEIGHT_COUNT) {
+        p = CFS_WEIGHT_COUNT - 1;
+    }
+    return CFS_WEIGHTS[p];
+}
+
+/**
+ * @brief CFS sıralaması: önce vruntime (policyKey), eşitse geliş zamanı, sonra id.
+ */
+static int cfsLess(const SimulationTask* a, const SimulationTask* b) {
+    if (a->policyKey != b->policyKey) {
+        return a->policyKey < b->policyKey;
+    }
+    return taskArrivedBefore(a, b);
+}
+
+/**
+ * @brief minVruntime'ı kümedeki en küçük vruntime'a doğru ilerletir (hiç geri gitmez).
+ */
+static void cfsUpdateMin(int core) {
+    SimulationTask* leftmost = thPeek(&trees[core]);
+    if (leftmost != NULL && leftmost->policyKey > minVruntime[core]) {
+        minVruntime[core] = leftmost->policyKey;
+    }
+}
+
+static void cfsInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        thInit(&trees[c], cfsLess);
+        minVruntime[c] = 0;
+        totalWeight[c] = 0;
+    }
+}
+
+/**
+ * @brief Görev çekirdeğin minVruntime'ına göre yerleşir.
+ *
+ * Görev kayıtları vruntime = 0 ile kurulur, çalınan görevin vruntime'ı ise kurbandan
+ * çıkarken göreli hale getirilir (bkz. cfsSteal). İkisinde de minVruntime eklenir:
+ * yeni gelen görev kümenin en gerisindekiyle aynı yerden başlar ve biriken
+ * vruntime'ı olan görevlerin önüne uzun süre geçemez; göç eden görev ise birikmiş
+ * farkını (lag) korur.
+ */
+static void cfsOnArrival(int core, SimulationTask* task) {
+    task->policyKey += minVruntime[core];
+    totalWeight[core] += cfsWeight(task);
+    thPush(&trees[core], task);
+}
+
+/**
+ * @brief vruntime'ı en küçük görev.
+ */
+static SimulationTask* cfsPickNext(int core) {
+    return thPeek(&trees[core]);
+}
+
+/**
+ * @brief Dilim = latency * ağırlık / toplam ağırlık, en az minGranularity.
+ *
+ * Çekirdekte n eşit ağırlıklı görev varsa her biri latency/n çalışır; görev sayısı
+ * latency/minGranularity'yi aşınca dilim alt sınırda kalır ve tur süresi uzar.
+ */
+static SimTime cfsTimeSlice(int core, const SimulationTask* task) {
+    SimTime slice = totalWeight[core] > 0 ? latency * cfsWeight(task) / totalWeight[core] : latency;
+    return slice > minGranularity ? slice : minGranularity;
+}
+
+/**
+ * @brief vruntime += ran * NICE0 / ağırlık; görev kümedeki yerini O(log n) günceller.
+ *
+ * Ağır (yüksek öncelikli) görevin vruntime'ı yavaş artar, bu yüzden daha sık seçilir.
+ */
+static int cfsOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    task->policyKey += ran * CFS_NICE0_WEIGHT / cfsWeight(task);
+    thUpdate(&trees[core], task);
+    cfsUpdateMin(core);
+    return 0;
+}
+
+static void cfsRemove(int core, SimulationTask* task) {
+    if (task->policyIndex < 0) {
+        return;
+    }
+    thRemove(&trees[core], task);
+    totalWeight[core] -= cfsWeight(task);
+    cfsUpdateMin(core);
+}
+
+/**
+ * @brief Kurbanın çalışmayan, vruntime'ı en küçük görevini çıkarır; vruntime göreli yapılır.
+ */
+static SimulationTask* cfsSteal(int victim, const SimulationTask* skip) {
+    SimulationTask* task = thFirstExcept(&trees[victim], skip);
+    if (task != NULL) {
+        cfsRemove(victim, task);
+        task->policyKey -= minVruntime[victim];
+    }
+    return task;
+}
+
+static int cfsLoad(int core) {
+    return trees[core].size;
+}
+
+/**
+ * @brief Gecikme hedefini ayarlar (bkz. policy.h).
+ */
+void cfsSetLatency(SimTime value) {
+    latency = value;
+}
+
+/**
+ * @brief En küçük dilimi ayarlar (bkz. policy.h).
+ */
+void cfsSetMinGranularity(SimTime value) {
+    minGranularity = value;
+}
+
+const SchedPolicy cfsPolicy = {
+    .name = "cfs",
+    .description = "Completely-Fair benzeri; oncelik agirliga donusur, en kucuk vruntime secilir",
+    .init = cfsInit,
+    .on_arrival = cfsOnArrival,
+    .pick_next = cfsPickNext,
+    .time_slice = cfsTimeSlice,
+    .account = NULL,
+    .on_quantum_expired = cfsOnQuantumExpired,
+    .on_complete = cfsRemove,
+    .on_timeout = cfsRemove,
+    .steal = cfsSteal,
+    .load = cfsLoad,
+    .report = NULL,
+};
@@ -0,0 +1,82 @@
+#include "policy.h"
+#include "task_heap.h"
+
+static TaskHeap heaps[SIM_MAX_CORES]; // Çekirdek başına, mutlak deadline'a göre sıralı hazır kümesi
+
+/**
+ * @brief EDF sıralaması: önce mutlak deadline (policyKey = dueTime), eşitse geliş zamanı, sonra id.
+ *
+ * Deadline'ı olmayan görevler (SIM_TIME_NEVER) deadline'lıların arkasında FCFS sırayla bekler.
+ */
+static int edfLess(const SimulationTask* a, const SimulationTask* b) {
+    if (a->policyKey != b->policyKey) {
+        return a->policyKey < b->policyKey;
+    }
+    return taskArrivedBefore(a, b);
+}
+
+static void edfInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        thInit(&heaps[c], edfLess);
+    }
+}
+
+/**
+ * @brief dueTime soğuk kayıttan bir kez policyKey'e kopyalanır; heap karşılaştırmaları sıcak kayıtta kalır.
+ */
+static void edfOnArrival(int core, SimulationTask* task) {
+    task->policyKey = getTaskCold(task)->dueTime;
+    thPush(&heaps[core], task);
+}
+
+/**
+ * @brief Deadline'ı en erken görev; her quantum yeniden seçildiği için quantum sınırında preemptive'dir.
+ */
+static SimulationTask* edfPickNext(int core) {
+    return thPeek(&heaps[core]);
+}
+
+/**
+ * @brief Quantum sonunda anahtar (policyKey = dueTime) değişmez; görev yerinde kalır.
+ */
+static int edfOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)core;
+    (void)task;
+    (void)ran;
+    return 0;
+}
+
+static void edfRemove(int core, SimulationTask* task) {
+    thRemove(&heaps[core], task);
+}
+
+/**
+ * @brief Kurbanın çalışmayan, deadline'ı en erken görevini çıkarır.
+ */
+static SimulationTask* edfSteal(int victim, const SimulationTask* skip) {
+    SimulationTask* task = thFirstExcept(&heaps[victim], skip);
+    if (task != NULL) {
+        thRemove(&heaps[victim], task);
+    }
+    return task;
+}
+
+static int edfLoad(int core) {
+    return heaps[core].size;
+}
+
+const SchedPolicy edfPolicy = {
+    .name = "edf",
+    .description = "Earliest-Deadline-First; mutlak deadline'a gore indeksli heap (oncelik yok sayilir)",
+    .init = edfInit,
+    .on_arrival = edfOnArrival,
+    .pick_next = edfPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = edfOnQuantumExpired,
+    .on_complete = edfRemove,
+    .on_timeout = edfRemove,
+    .steal = edfSteal,
+    .load = edfLoad,
+    .report = NULL,
+};
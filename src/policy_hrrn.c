@@ -0,0 +1,99 @@
+#include "policy.h"
+#include "kinetic_heap.h"
+
+extern SimTime globalTimer; // scheduler.c: seçim anı (oranlar buna göre hesaplanır)
+
+static KineticHeap trees[SIM_MAX_CORES];       // Çekirdek başına, bekleyen görevlerin oran ağacı
+static SimulationTask* running[SIM_MAX_CORES]; // Bitene kadar çekirdeği tutan görev (NULL: yok)
+
+static void hrrnInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        khInit(&trees[c]);
+        running[c] = NULL;
+    }
+}
+
+/**
+ * @brief Bekleyen görev ağaca girer; çalınan görev ise doğrudan thief'in çalışan görevi olur.
+ *
+ * Oranın paydası (burstTime) soğuk kayıttan bir kez policyKey'e kopyalanır (bkz.
+ * kinetic_heap.h). Çalınan görev bu quantum'da thief'te çalışır (bkz. stealTask);
+ * non-preemptive sırayı korumak için ağaca girmez, POLICY_STOLEN işaretiyle tanınır.
+ */
+static void hrrnOnArrival(int core, SimulationTask* task) {
+    SimTime burst = getTaskCold(task)->burstTime;
+    task->policyKey = burst > 0 ? burst : 1;
+
+    if (task->policyIndex == POLICY_STOLEN && running[core] == NULL) {
+        task->policyIndex = -1;
+        running[core] = task;
+        return;
+    }
+    task->policyIndex = -1;
+    khInsert(&trees[core], task);
+}
+
+/**
+ * @brief Çalışan görev bitene kadar seçilir; sonra yanıt oranı en büyük bekleyen görev başlar.
+ *
+ * Oran (bekleme + süre) / süre'dir; seçilen görev ağaçtan çıkar, bitene kadar oranı
+ * diğerleriyle yarışmaz.
+ */
+static SimulationTask* hrrnPickNext(int core) {
+    if (running[core] == NULL) {
+        running[core] = khMax(&trees[core], globalTimer);
+        if (running[core] != NULL) {
+            khRemove(&trees[core], running[core]);
+        }
+    }
+    return running[core];
+}
+
+static int hrrnOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)core;
+    (void)task;
+    (void)ran;
+    return 0;
+}
+
+static void hrrnRemove(int core, SimulationTask* task) {
+    khRemove(&trees[core], task);
+    if (running[core] == task) {
+        running[core] = NULL;
+    }
+}
+
+/**
+ * @brief Kurbanın bekleyen görevleri arasında oranı en büyük olanı çıkarır.
+ *
+ * Çalışan görev (skip) zaten ağaçta değildir.
+ */
+static SimulationTask* hrrnSteal(int victim, const SimulationTask* skip) {
+    (void)skip;
+    SimulationTask* task = khMax(&trees[victim], globalTimer);
+    if (task != NULL) {
+        khRemove(&trees[victim], task);
+        task->policyIndex = POLICY_STOLEN;
+    }
+    return task;
+}
+
+static int hrrnLoad(int core) {
+    return trees[core].count + (running[core] != NULL ? 1 : 0);
+}
+
+const SchedPolicy hrrnPolicy = {
+    .name = "hrrn",
+    .description = "Highest-Response-Ratio-Next (non-preemptive); kinetik turnuva agaciyla en buyuk oran",
+    .init = hrrnInit,
+    .on_arrival = hrrnOnArrival,
+    .pick_next = hrrnPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = hrrnOnQuantumExpired,
+    .on_complete = hrrnRemove,
+    .on_timeout = hrrnRemove,
+    .steal = hrrnSteal,
+    .load = hrrnLoad,
+    .report = NULL,
+};
@@ -0,0 +1,262 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "policy.h"
+
+#define LOTTERY_LEVELS 6 // Kademe düşürmenin durduğu seviye sayısı (MLFQ ile aynı)
+
+/**
+ * @brief Bir çekirdeğin bilet indeksi: konumlar üzerinde Fenwick (binary indexed) ağacı.
+ *
+ * Her hazır görev bir konum tutar (SimulationTask.policyIndex, 1'den başlar); boşalan
+ * konumlar yığında tutulup yeniden kullanılır. tree[] önek toplamlarını taşır; bilet
+ * değişimi ve çekiliş O(log kapasite), büyüme (kapasite ikiye katlanırken yeniden kurma)
+ * amortize O(1)'dir.
+ */
+typedef struct {
+    long* tree;               // Fenwick dizisi (1..capacity)
+    int* tickets;             // Konumdaki görevin bileti (boş konumda 0)
+    SimulationTask** owner;   // Konumdaki görev (boş konumda NULL)
+    int* freeSlots;           // Boş konum yığını
+    int freeCount;
+    int used;                 // Şimdiye dek verilen en büyük konum
+    int capacity;             // 2'nin kuvveti
+    int count;                // Kümedeki görev sayısı
+    long total;               // Toplam bilet
+} TicketIndex;
+
+static TicketIndex indexes[SIM_MAX_CORES];
+static uint64_t rngState = 1; // splitmix64 durumu (--seed ile ayarlanır)
+
+/**
+ * @brief splitmix64: tohumdan belirlenen, platformdan bağımsız tekrarlanabilir sayı dizisi.
+ */
+static uint64_t lotteryRandom(void) {
+    uint64_t z = (rngState += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief [0, bound) aralığında düzgün dağılımlı sayı (çarp-kaydır; bölme yok).
+ */
+static long lotteryDraw(long bound) {
+    return (long)(((unsigned __int128)lotteryRandom() * (uint64_t)bound) >> 64);
+}
+
+static int lotteryTickets(const SimulationTask* task) {
+    return policyTickets(task->priority);
+}
+
+/**
+ * @brief pos konumunun biletine delta ekler.
+ */
+static void tiAdd(TicketIndex* ti, int pos, long delta) {
+    ti->total += delta;
+    for (; pos <= ti->capacity; pos += pos & -pos) {
+        ti->tree[pos] += delta;
+    }
+}
+
+/**
+ * @brief 1..pos konumlarının bilet toplamı.
+ */
+static long tiPrefix(const TicketIndex* ti, int pos) {
+    long sum = 0;
+    for (; pos > 0; pos -= pos & -pos) {
+        sum += ti->tree[pos];
+    }
+    return sum;
+}
+
+/**
+ * @brief Önek toplamı ticket'ı aşan ilk konum (0 <= ticket < total); Fenwick üzerinde iniş.
+ */
+static int tiFind(const TicketIndex* ti, long ticket) {
+    int pos = 0;
+    for (int step = ti->capacity; step > 0; step >>= 1) {
+        if (pos + step <= ti->capacity && ti->tree[pos + step] <= ticket) {
+            pos += step;
+            ticket -= ti->tree[pos];
+        }
+    }
+    return pos + 1;
+}
+
+/**
+ * @brief Kapasiteyi ikiye katlar ve Fenwick dizisini biletlerden O(n) yeniden kurar.
+ */
+static void tiGrow(TicketIndex* ti) {
+    int capacity = ti->capacity ? ti->capacity * 2 : 64;
+    long* tree = calloc((size_t)capacity + 1, sizeof(*tree));
+    int* tickets = calloc((size_t)capacity + 1, sizeof(*tickets));
+    SimulationTask** owner = calloc((size_t)capacity + 1, sizeof(*owner));
+    int* freeSlots = malloc((size_t)capacity * sizeof(*freeSlots));
+    if (!tree || !tickets || !owner || !freeSlots) {
+        printf("Hata: bilet indeksi icin bellek ayrilamadi.\n");
+        exit(1);
+    }
+
+    for (int pos = 1; pos <= capacity; pos++) {
+        if (pos <= ti->used) {
+            tickets[pos] = ti->tickets[pos];
+            owner[pos] = ti->owner[pos];
+            tree[pos] += tickets[pos];
+        }
+        int parent = pos + (pos & -pos);
+        if (parent <= capacity) {
+            tree[parent] += tree[pos];
+        }
+    }
+    for (int i = 0; i < ti->freeCount; i++) {
+        freeSlots[i] = ti->freeSlots[i];
+    }
+
+    free(ti->tree);
+    free(ti->tickets);
+    free(ti->owner);
+    free(ti->freeSlots);
+    ti->tree = tree;
+    ti->tickets = tickets;
+    ti->owner = owner;
+    ti->freeSlots = freeSlots;
+    ti->capacity = capacity;
+}
+
+static void lotteryInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        TicketIndex* ti = &indexes[c];
+        free(ti->tree);
+        free(ti->tickets);
+        free(ti->owner);
+        free(ti->freeSlots);
+        ti->tree = NULL;
+        ti->tickets = NULL;
+        ti->owner = NULL;
+        ti->freeSlots = NULL;
+        ti->freeCount = 0;
+        ti->used = 0;
+        ti->capacity = 0;
+        ti->count = 0;
+        ti->total = 0;
+    }
+}
+
+/**
+ * @brief Görev boş bir konuma biletleriyle girer.
+ */
+static void lotteryOnArrival(int core, SimulationTask* task) {
+    TicketIndex* ti = &indexes[core];
+    int pos;
+
+    if (ti->freeCount > 0) {
+        pos = ti->freeSlots[--ti->freeCount];
+    }
+    else {
+        if (ti->used == ti->capacity) {
+            tiGrow(ti);
+        }
+        pos = ++ti->used;
+    }
+
+    task->policyIndex = pos;
+    ti->owner[pos] = task;
+    ti->tickets[pos] = lotteryTickets(task);
+    tiAdd(ti, pos, ti->tickets[pos]);
+    ti->count++;
+}
+
+/**
+ * @brief Çekiliş: [0, toplam bilet) aralığından bir bilet çekilir, sahibini Fenwick bulur.
+ */
+static SimulationTask* lotteryPickNext(int core) {
+    TicketIndex* ti = &indexes[core];
+    if (ti->total == 0) {
+        return NULL;
+    }
+    return ti->owner[tiFind(ti, lotteryDraw(ti->total))];
+}
+
+/**
+ * @brief Quantum sonu: MLFQ ile aynı kademe düşürme, biletler yeni seviyeye O(log n) güncellenir.
+ */
+static int lotteryOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)ran;
+    if (task->priority > 0 && task->priority < LOTTERY_LEVELS - 1) {
+        TicketIndex* ti = &indexes[core];
+        int pos = task->policyIndex;
+        task->priority++;
+        int tickets = lotteryTickets(task);
+        tiAdd(ti, pos, tickets - ti->tickets[pos]);
+        ti->tickets[pos] = tickets;
+        return 1;
+    }
+    return 0;
+}
+
+static void lotteryRemove(int core, SimulationTask* task) {
+    TicketIndex* ti = &indexes[core];
+    int pos = task->policyIndex;
+    if (pos <= 0) {
+        return;
+    }
+
+    tiAdd(ti, pos, -ti->tickets[pos]);
+    ti->tickets[pos] = 0;
+    ti->owner[pos] = NULL;
+    ti->freeSlots[ti->freeCount++] = pos;
+    ti->count--;
+    task->policyIndex = -1;
+}
+
+/**
+ * @brief Kurbanda skip hariç biletler arasında çekiliş yapar ve kazananı çıkarır.
+ *
+ * skip'in biletleri çekiliş aralığından düşülür; çekilen bilet skip'in önek aralığına
+ * denk gelirse onun biletleri kadar ileri kaydırılır. Maliyet O(log n).
+ */
+static SimulationTask* lotterySteal(int victim, const SimulationTask* skip) {
+    TicketIndex* ti = &indexes[victim];
+    int skipPos = skip != NULL ? skip->policyIndex : 0;
+    long skipTickets = skipPos > 0 ? ti->tickets[skipPos] : 0;
+
+    if (ti->total - skipTickets <= 0) {
+        return NULL;
+    }
+
+    long ticket = lotteryDraw(ti->total - skipTickets);
+    if (skipPos > 0 && ticket >= tiPrefix(ti, skipPos - 1)) {
+        ticket += skipTickets;
+    }
+
+    SimulationTask* task = ti->owner[tiFind(ti, ticket)];
+    lotteryRemove(victim, task);
+    return task;
+}
+
+static int lotteryLoad(int core) {
+    return indexes[core].count;
+}
+
+/**
+ * @brief Çekiliş tohumunu ayarlar (bkz. policy.h).
+ */
+void lotterySetSeed(uint64_t seed) {
+    rngState = seed;
+}
+
+const SchedPolicy lotteryPolicy = {
+    .name = "lottery",
+    .description = "Piyango; oncelik bilete donusur (32..1), Fenwick agaciyla O(log n) cekilis",
+    .init = lotteryInit,
+    .on_arrival = lotteryOnArrival,
+    .pick_next = lotteryPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = lotteryOnQuantumExpired,
+    .on_complete = lotteryRemove,
+    .on_timeout = lotteryRemove,
+    .steal = lotterySteal,
+    .load = lotteryLoad,
+    .report = NULL,
+};
@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "policy.h"
+#include "ready_queue.h"
+
+#define MLFQ_RR_LEVEL 3    // Round-Robin ile dönen seviye
+#define MLFQ_BOOST_LEVEL 1 // Yükseltmede kullanıcı seviyelerinin toplandığı seviye
+
+extern SimTime globalTimer; // scheduler.c: yükseltme zamanı buna göre izlenir
+
+static ReadyQueues queues[SIM_MAX_CORES]; // Çekirdek başına, seviye başına hazır görev kuyrukları
+static int queueCount = 0;                // init'te hazırlanan çekirdek sayısı
+static int rrLast[SIM_MAX_CORES];         // Çekirdek başına Round-Robin seviyesinde en son seçilen görevin kimliği
+static int levelCount = READY_LEVELS;     // Kullanılan seviye sayısı (bkz. mlfqSetLevels)
+static int rrLevel = MLFQ_RR_LEVEL;       // Round-Robin seviyesi: min(MLFQ_RR_LEVEL, levelCount - 1)
+
+// === Periyodik öncelik yükseltme (boost) ===
+static SimTime boostPeriod = 0;           // 0: kapalı
+static SimTime nextBoost = SIM_TIME_NEVER;
+static int64_t boostEpoch = 0;            // Yapılan yükseltme sayısı; görevin policyKey'i ile karşılaştırılır
+
+/**
+ * @brief Görevin priority alanını son yükseltmeye göre tembel düzeltir.
+ *
+ * Yükseltme kuyrukları yalnızca birbirine bağlar; taşınan görevlerin priority alanı
+ * eski seviyede kalır. Görevin policyKey'i, seviyesinin en son hangi yükseltme
+ * sayısına göre bilindiğini tutar: geride kalmışsa ve görev seviye 2..5'teyse arada
+ * yapılan yükseltmede seviye 1'e taşınmıştır.
+ * Görevin seviyesi okunmadan (kuyruktan çıkarma, kademe düşürme, log) önce çağrılır.
+ */
+static void mlfqSync(SimulationTask* task) {
+    if (task->policyKey != boostEpoch) {
+        if (task->priority > MLFQ_BOOST_LEVEL && task->priority < levelCount) {
+            task->priority = MLFQ_BOOST_LEVEL;
+        }
+        task->policyKey = boostEpoch;
+    }
+}
+
+/**
+ * @brief Yükseltme zamanı geldiyse her çekirdekte seviye 2..levelCount-1'i seviye 1'in sonuna ekler.
+ *
+ * Çekirdek başına levelCount - 2 liste birleştirme yapılır; maliyet görev sayısından
+ * bağımsızdır. Seviye 0 (gerçek zamanlı) yükseltmeden etkilenmez. Boşta geçen birden çok
+ * periyot tek yükseltme sayılır.
+ */
+static void mlfqMaybeBoost(void) {
+    if (globalTimer < nextBoost) {
+        return;
+    }
+
+    for (int c = 0; c < queueCount; c++) {
+        for (int p = MLFQ_BOOST_LEVEL + 1; p < levelCount; p++) {
+            rqSplice(&queues[c], p, MLFQ_BOOST_LEVEL);
+        }
+    }
+    boostEpoch++;
+    nextBoost = (globalTimer / boostPeriod + 1) * boostPeriod;
+}
+
+static void mlfqInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        rqInit(&queues[c]);
+        rrLast[c] = -1;
+    }
+    queueCount = cores;
+    boostEpoch = 0;
+    nextBoost = boostPeriod > 0 ? boostPeriod : SIM_TIME_NEVER;
+}
+
+/**
+ * @brief Görevi seviyesinde kimlik sırasındaki yerine koyar.
+ *
+ * Round-Robin seviyesinde sıra, çekirdeğin en son seçtiği kimlikten sonra döner
+ * (bkz. rqInsert); diğer seviyelerde en küçük kimlik öndedir. levelCount ve üstündeki
+ * seviyeler kuyruğa alınmaz.
+ */
+static void mlfqEnqueue(int core, SimulationTask* task) {
+    if (task->priority < levelCount) {
+        rqInsert(&queues[core], task, task->priority == rrLevel ? rrLast[core] : -1);
+    }
+}
+
+/**
+ * @brief Görev kendi seviyesinin kuyruğuna kimlik sırasıyla girer.
+ *
+ * 0..levelCount-1 dışındaki seviyeler kuyruğa alınmaz; bu görevler hiç seçilmez (zaman aşımına kadar bekler).
+ */
+static void mlfqOnArrival(int core, SimulationTask* task) {
+    task->policyKey = boostEpoch;
+    mlfqEnqueue(core, task);
+}
+
+/**
+ * @brief Sıradaki çalıştırılacak görevi seçer.
+ *
+ * Seçim politikası:
+ * - En yüksek öncelikli (sayısal olarak en küçük) dolu hazır kuyruğu bitmap'ten bulunur
+ * - Priority 0, 1-2 ve 4-5: kuyruğun başındaki, yani kimliği en küçük görev seçilir
+ * - Priority 3: Round-Robin; en son seçilen kimlikten sonraki ilk görev (baştaki)
+ *   seçilir ve kuyruğun sonuna döndürülür (4'ten az seviyede en alt seviye, bkz. mlfqSetLevels)
+ *
+ * Seçim görev sayısından bağımsız olarak O(1)'dir.
+ */
+static SimulationTask* mlfqPickNext(int core) {
+    mlfqMaybeBoost();
+
+    ReadyQueues* rq = &queues[core];
+    int level = rqHighestLevel(rq);
+    SimulationTask* task;
+
+    // Çalıştırılacak görev yok
+    if (level < 0) {
+        return NULL;
+    }
+
+    // Round-Robin seviyesi (varsayılan priority 3): dönen kuyruk
+    if (level == rrLevel) {
+        task = rqRotate(rq, level);
+        rrLast[core] = getTaskCold(task)->id;
+    }
+    else {
+        task = rqHead(rq, level);
+    }
+
+    mlfqSync(task);
+    return task;
+}
+
+/**
+ * @brief Quantum sonu: 0 < priority < levelCount - 1 ise görev bir kademe düşer (sayısal olarak artar).
+ *
+ * Priority 0 (gerçek zamanlı) ve en alt seviye yerinde kalır.
+ */
+static int mlfqOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)ran;
+    mlfqSync(task);
+    if (task->priority > 0 && task->priority < levelCount - 1) {
+        rqRemove(&queues[core], task, task->priority);
+        task->priority++;
+        mlfqEnqueue(core, task);
+        return 1;
+    }
+    return 0;
+}
+
+static void mlfqRemove(int core, SimulationTask* task) {
+    mlfqSync(task);
+    rqRemove(&queues[core], task, task->priority);
+}
+
+/**
+ * @brief Kurbanın çalışmayan en yüksek öncelikli görevini çıkarır (hırsızda aynı seviyeye kimlik sırasıyla girer).
+ */
+static SimulationTask* mlfqSteal(int victim, const SimulationTask* skip) {
+    SimulationTask* task = rqFirstExcept(&queues[victim], skip);
+    if (task != NULL) {
+        mlfqSync(task);
+        rqRemove(&queues[victim], task, task->priority);
+    }
+    return task;
+}
+
+static int mlfqLoad(int core) {
+    return queues[core].count;
+}
+
+/**
+ * @brief Yükseltme açıksa yapılan yükseltme sayısını basar.
+ */
+static void mlfqReport(void) {
+    if (boostPeriod > 0) {
+        char period[32];
+        simFormatSeconds(period, sizeof(period), boostPeriod);
+        printf("Priority Boosts        : %lld (every %s sec)\n", (long long)boostEpoch, period);
+    }
+}
+
+/**
+ * @brief Yükseltme periyodunu ayarlar (bkz. policy.h).
+ */
+void mlfqSetBoostPeriod(SimTime period) {
+    boostPeriod = period;
+}
+
+/**
+ * @brief Kullanılan seviye sayısını ayarlar (bkz. policy.h).
+ */
+void mlfqSetLevels(int levels) {
+    if (levels < 2 || levels > READY_LEVELS) {
+        printf("Hata: seviye sayisi 2..%d araliginda olmali.\n", READY_LEVELS);
+        exit(1);
+    }
+    levelCount = levels;
+    rrLevel = levels - 1 < MLFQ_RR_LEVEL ? levels - 1 : MLFQ_RR_LEVEL;
+}
+
+const SchedPolicy mlfqPolicy = {
+    .name = "mlfq",
+    .description = "6 seviyeli geri beslemeli kuyruk; 0 FCFS, seviye 3 Round-Robin",
+    .init = mlfqInit,
+    .on_arrival = mlfqOnArrival,
+    .pick_next = mlfqPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = mlfqOnQuantumExpired,
+    .on_complete = mlfqRemove,
+    .on_timeout = mlfqRemove,
+    .steal = mlfqSteal,
+    .load = mlfqLoad,
+    .report = mlfqReport,
+};
@@ -0,0 +1,124 @@
+#include "policy.h"
+#include "task_heap.h"
+
+static TaskHeap heaps[SIM_MAX_CORES];          // Çekirdek başına, kalan süreye göre sıralı hazır kümesi
+static SimulationTask* running[SIM_MAX_CORES]; // SJF: bitene kadar çekirdeği tutan görev (NULL: yok)
+
+/**
+ * @brief Önce kalan süre, eşitse geliş zamanı, sonra id.
+ */
+static int srtfLess(const SimulationTask* a, const SimulationTask* b) {
+    if (a->remainingTime != b->remainingTime) {
+        return a->remainingTime < b->remainingTime;
+    }
+    return taskArrivedBefore(a, b);
+}
+
+static void srtfInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        thInit(&heaps[c], srtfLess);
+        running[c] = NULL;
+    }
+}
+
+static void srtfOnArrival(int core, SimulationTask* task) {
+    thPush(&heaps[core], task);
+}
+
+/**
+ * @brief SJF gelişi: çalınan görev (POLICY_STOLEN) hırsızın çalışan görevi olur.
+ *
+ * Çalınan görev bu quantum'da hırsızda çalışır (bkz. stealTask); running'e yazılmazsa
+ * sonraki quantum'da daha kısa bir görev onu keserdi. Görev SJF'de de heap'te kalır.
+ */
+static void sjfOnArrival(int core, SimulationTask* task) {
+    int stolen = task->policyIndex == POLICY_STOLEN;
+
+    thPush(&heaps[core], task);
+    if (stolen && running[core] == NULL) {
+        running[core] = task;
+    }
+}
+
+/**
+ * @brief SRTF: her quantum kalan süresi en kısa görev (quantum sınırında preemptive).
+ */
+static SimulationTask* srtfPickNext(int core) {
+    return thPeek(&heaps[core]);
+}
+
+/**
+ * @brief SJF: çekirdeği tutan görev bitene kadar seçilir; sonra kalan süresi en kısa olan başlar.
+ *
+ * Henüz başlamamış görevde kalan süre toplam süredir; yani seçim klasik SJF'dir.
+ */
+static SimulationTask* sjfPickNext(int core) {
+    if (running[core] == NULL) {
+        running[core] = thPeek(&heaps[core]);
+    }
+    return running[core];
+}
+
+/**
+ * @brief Kalan süre azaldı; görevin anahtarı O(log n) güncellenir (yalnızca köke doğru kayar).
+ */
+static int srtfOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)ran;
+    thUpdate(&heaps[core], task);
+    return 0;
+}
+
+static void srtfRemove(int core, SimulationTask* task) {
+    thRemove(&heaps[core], task);
+    if (running[core] == task) {
+        running[core] = NULL;
+    }
+}
+
+/**
+ * @brief Kurbanın çalışmayan, kalan süresi en kısa görevini çıkarır.
+ */
+static SimulationTask* srtfSteal(int victim, const SimulationTask* skip) {
+    SimulationTask* task = thFirstExcept(&heaps[victim], skip);
+    if (task != NULL) {
+        srtfRemove(victim, task);
+        task->policyIndex = POLICY_STOLEN;
+    }
+    return task;
+}
+
+static int srtfLoad(int core) {
+    return heaps[core].size;
+}
+
+const SchedPolicy srtfPolicy = {
+    .name = "srtf",
+    .description = "Shortest-Remaining-Time-First; kalan sureye gore min-heap, quantum sinirinda preemptive",
+    .init = srtfInit,
+    .on_arrival = srtfOnArrival,
+    .pick_next = srtfPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = srtfOnQuantumExpired,
+    .on_complete = srtfRemove,
+    .on_timeout = srtfRemove,
+    .steal = srtfSteal,
+    .load = srtfLoad,
+    .report = NULL,
+};
+
+const SchedPolicy sjfPolicy = {
+    .name = "sjf",
+    .description = "Shortest-Job-First (non-preemptive); baslayan gorev bitene kadar calisir",
+    .init = srtfInit,
+    .on_arrival = sjfOnArrival,
+    .pick_next = sjfPickNext,
+    .time_slice = NULL,
+    .account = NULL,
+    .on_quantum_expired = srtfOnQuantumExpired,
+    .on_complete = srtfRemove,
+    .on_timeout = srtfRemove,
+    .steal = srtfSteal,
+    .load = srtfLoad,
+    .report = NULL,
+};
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include "policy.h"
+#include "task_heap.h"
+
+#define STRIDE_ONE (1 << 20) // Bilet başına adımın payı: stride = STRIDE_ONE / bilet
+
+static TaskHeap queues[SIM_MAX_CORES];    // Çekirdek başına, pass değerine göre sıralı hazır kümesi
+static int64_t globalPass[SIM_MAX_CORES]; // Çekirdeğin sanal saati: tüm biletlere göre ilerleyen pass
+static long coreTickets[SIM_MAX_CORES];   // Çekirdekteki hazır görevlerin bilet toplamı
+static long classTickets[SIM_MAX_CORES][POLICY_SHARE_CLASSES]; // Aynı toplamın sınıflara dağılımı
+
+// === Pay istatistikleri (özet rapor için, tick) ===
+static SimTime classService[POLICY_SHARE_CLASSES]; // Sınıfın aldığı CPU süresi
+static double classTarget[POLICY_SHARE_CLASSES];   // Sınıfın bilet payına göre alması gereken süre
+static SimTime totalService = 0;
+
+/**
+ * @brief Önce pass (policyKey), eşitse geliş zamanı, sonra id.
+ */
+static int strideLess(const SimulationTask* a, const SimulationTask* b) {
+    if (a->policyKey != b->policyKey) {
+        return a->policyKey < b->policyKey;
+    }
+    return taskArrivedBefore(a, b);
+}
+
+static void strideInit(int cores) {
+    for (int c = 0; c < cores; c++) {
+        thInit(&queues[c], strideLess);
+        globalPass[c] = 0;
+        coreTickets[c] = 0;
+        for (int k = 0; k < POLICY_SHARE_CLASSES; k++) {
+            classTickets[c][k] = 0;
+        }
+    }
+}
+
+/**
+ * @brief Katılım: pass = globalPass + görevin kalan farkı (remain).
+ *
+ * Yeni görevin farkı 0'dır (kayıt policyKey = 0 ile kurulur); çalınan görevin farkı
+ * kurbandan çıkarken saklanır (bkz. strideSteal). Diğer görevlerin pass değerlerine
+ * dokunulmaz; katılım ve ayrılma O(log n)'dir, genel yeniden normalleştirme gerekmez.
+ */
+static void strideOnArrival(int core, SimulationTask* task) {
+    int tickets = policyTickets(task->priority);
+
+    task->policyKey += globalPass[core];
+    coreTickets[core] += tickets;
+    classTickets[core][policyShareClass(task->priority)] += tickets;
+    thPush(&queues[core], task);
+}
+
+/**
+ * @brief En küçük pass değerli görev.
+ */
+static SimulationTask* stridePickNext(int core) {
+    return thPeek(&queues[core]);
+}
+
+/**
+ * @brief Hizmet muhasebesi: görevin pass'i ran * stride, çekirdeğin globalPass'i
+ *        ran * STRIDE_ONE / toplam bilet kadar ilerler.
+ *
+ * Bu quantum'da her sınıfın hedefi, o anki bilet payı kadar artar; böylece gelişler ve
+ * ayrılmalarla değişen hazır küme de hedef payı doğru ağırlıklandırır.
+ */
+static void strideAccount(int core, SimulationTask* task, SimTime ran) {
+    int tickets = policyTickets(task->priority);
+
+    task->policyKey += ran * (STRIDE_ONE / tickets);
+    globalPass[core] += ran * STRIDE_ONE / coreTickets[core];
+
+    classService[policyShareClass(task->priority)] += ran;
+    totalService += ran;
+    for (int k = 0; k < POLICY_SHARE_CLASSES; k++) {
+        classTarget[k] += (double)ran * classTickets[core][k] / coreTickets[core];
+    }
+}
+
+/**
+ * @brief pass strideAccount'ta arttı; görevin yeri O(log n) düzeltilir.
+ */
+static int strideOnQuantumExpired(int core, SimulationTask* task, SimTime ran) {
+    (void)ran;
+    thUpdate(&queues[core], task);
+    return 0;
+}
+
+/**
+ * @brief Ayrılma: görev kümeden ve bilet toplamlarından çıkar.
+ */
+static void strideRemove(int core, SimulationTask* task) {
+    if (task->policyIndex < 0) {
+        return;
+    }
+
+    int tickets = policyTickets(task->priority);
+    thRemove(&queues[core], task);
+    coreTickets[core] -= tickets;
+    classTickets[core][policyShareClass(task->priority)] -= tickets;
+}
+
+/**
+ * @brief Kurbanın çalışmayan, pass'i en küçük görevini çıkarır; farkı (remain) saklanır.
+ */
+static SimulationTask* strideSteal(int victim, const SimulationTask* skip) {
+    SimulationTask* task = thFirstExcept(&queues[victim], skip);
+    if (task != NULL) {
+        strideRemove(victim, task);
+        task->policyKey -= globalPass[victim];
+    }
+    return task;
+}
+
+static int strideLoad(int core) {
+    return queues[core].size;
+}
+
+/**
+ * @brief Sınıf başına gerçekleşen CPU payı ile bilet payından beklenen payı basar.
+ */
+static void strideReport(void) {
+    if (totalService == 0) {
+        return;
+    }
+    for (int k = 0; k < POLICY_SHARE_CLASSES; k++) {
+        if (classService[k] == 0 && classTarget[k] == 0) {
+            continue;
+        }
+        printf("Class %d CPU Share      : %.1f%% (target %.1f%%)\n", k,
+            100.0 * (double)classService[k] / (double)totalService,
+            100.0 * classTarget[k] / (double)totalService);
+    }
+}
+
+const SchedPolicy stridePolicy = {
+    .name = "stride",
+    .description = "Stride; oncelik bilete donusur (32..1), en kucuk pass degeri secilir",
+    .init = strideInit,
+    .on_arrival = strideOnArrival,
+    .pick_next = stridePickNext,
+    .time_slice = NULL,
+    .account = strideAccount,
+    .on_quantum_expired = strideOnQuantumExpired,
+    .on_complete = strideRemove,
+    .on_timeout = strideRemove,
+    .steal = strideSteal,
+    .load = strideLoad,
+    .report = strideReport,
+};
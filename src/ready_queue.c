@@ -0,0 +1,180 @@
+#include <stddef.h>
+#include "ready_queue.h"
+
+/**
+ * @brief Tüm seviyeleri boşaltır.
+ */
+void rqInit(ReadyQueues* rq) {
+    for (int p = 0; p < READY_LEVELS; p++) {
+        rq->head[p] = NULL;
+        rq->tail[p] = NULL;
+    }
+    rq->nonEmptyMask = 0;
+    rq->count = 0;
+}
+
+/**
+ * @brief a, after'a göre döngüsel kimlik sırasında b'den önce mi gelir (bkz. rqInsert).
+ */
+static int rqOrderedBefore(const SimulationTask* a, const SimulationTask* b, int after) {
+    int aId = getTaskCold(a)->id;
+    int bId = getTaskCold(b)->id;
+    int aWrapped = aId <= after;
+    int bWrapped = bId <= after;
+    if (aWrapped != bWrapped) {
+        return bWrapped;
+    }
+    return aId < bId;
+}
+
+/**
+ * @brief Görevi p seviyesinde prev'in arkasına bağlar (prev NULL ise başa).
+ */
+static void rqLinkAfter(ReadyQueues* rq, SimulationTask* task, SimulationTask* prev, int p) {
+    SimulationTask* next = prev != NULL ? prev->rqNext : rq->head[p];
+
+    task->rqPrev = prev;
+    task->rqNext = next;
+
+    if (prev != NULL) {
+        prev->rqNext = task;
+    }
+    else {
+        rq->head[p] = task;
+    }
+    if (next != NULL) {
+        next->rqPrev = task;
+    }
+    else {
+        rq->tail[p] = task;
+    }
+
+    rq->nonEmptyMask |= 1u << p;
+    rq->count++;
+}
+
+/**
+ * @brief Görevi kendi seviyesinde kimlik sırasındaki yerine ekler (bkz. ready_queue.h).
+ */
+int rqInsert(ReadyQueues* rq, SimulationTask* task, int after) {
+    int p = task->priority;
+    if (p < 0 || p >= READY_LEVELS) {
+        return 0;
+    }
+
+    SimulationTask* prev = rq->tail[p];
+    while (prev != NULL && rqOrderedBefore(task, prev, after)) {
+        prev = prev->rqPrev;
+    }
+    rqLinkAfter(rq, task, prev, p);
+    return 1;
+}
+
+/**
+ * @brief Görevi seviyesinden çıkarır; seviye boşalırsa bitmap'teki biti temizler.
+ */
+void rqRemove(ReadyQueues* rq, SimulationTask* task, int level) {
+    if (level < 0 || level >= READY_LEVELS) {
+        return;
+    }
+    // Kuyrukta olmayan görev: ne bağı var ne de seviyenin tek elemanı
+    if (task->rqPrev == NULL && rq->head[level] != task) {
+        return;
+    }
+
+    if (task->rqPrev != NULL) {
+        task->rqPrev->rqNext = task->rqNext;
+    }
+    else {
+        rq->head[level] = task->rqNext;
+    }
+
+    if (task->rqNext != NULL) {
+        task->rqNext->rqPrev = task->rqPrev;
+    }
+    else {
+        rq->tail[level] = task->rqPrev;
+    }
+
+    task->rqNext = NULL;
+    task->rqPrev = NULL;
+    rq->count--;
+
+    if (rq->head[level] == NULL) {
+        rq->nonEmptyMask &= ~(1u << level);
+    }
+}
+
+/**
+ * @brief Seviyenin başındaki görev.
+ */
+SimulationTask* rqHead(const ReadyQueues* rq, int level) {
+    return rq->head[level];
+}
+
+/**
+ * @brief En düşük numaralı dolu seviye (bitmap'te en düşük set bit).
+ */
+int rqHighestLevel(const ReadyQueues* rq) {
+    if (rq->nonEmptyMask == 0) {
+        return -1;
+    }
+    return __builtin_ctz(rq->nonEmptyMask);
+}
+
+/**
+ * @brief Baştaki görevi sona taşır (tek elemanlı seviyede değişiklik olmaz).
+ */
+SimulationTask* rqRotate(ReadyQueues* rq, int level) {
+    SimulationTask* first = rq->head[level];
+    if (first != NULL && first->rqNext != NULL) {
+        rqRemove(rq, first, level);
+        rqLinkAfter(rq, first, rq->tail[level], level);
+    }
+    return first;
+}
+
+/**
+ * @brief skip dışındaki en yüksek öncelikli görev (bkz. ready_queue.h).
+ */
+SimulationTask* rqFirstExcept(const ReadyQueues* rq, const SimulationTask* skip) {
+    unsigned int mask = rq->nonEmptyMask;
+
+    while (mask != 0) {
+        int level = __builtin_ctz(mask);
+        SimulationTask* task = rq->head[level];
+
+        if (task == skip) {
+            task = task->rqNext;
+        }
+        if (task != NULL) {
+            return task;
+        }
+        mask &= mask - 1;
+    }
+    return NULL;
+}
+
+/**
+ * @brief from listesini to listesinin sonuna bağlar (bkz. ready_queue.h).
+ */
+void rqSplice(ReadyQueues* rq, int from, int to) {
+    SimulationTask* first = rq->head[from];
+    if (first == NULL || from == to) {
+        return;
+    }
+
+    first->rqPrev = rq->tail[to];
+    if (rq->tail[to] != NULL) {
+        rq->tail[to]->rqNext = first;
+    }
+    else {
+        rq->head[to] = first;
+    }
+    rq->tail[to] = rq->tail[from];
+
+    rq->head[from] = NULL;
+    rq->tail[from] = NULL;
+    rq->nonEmptyMask &= ~(1u << from);
+    rq->nonEmptyMask |= 1u << to;
+}
@@ -0,0 +1,89 @@
+#ifndef READY_QUEUE_H
+#define READY_QUEUE_H
+
+#include "scheduler.h"
+
+#define READY_LEVELS 6  // Öncelik seviyesi sayısı (0 en yüksek, 5 en düşük)
+
+/**
+ * @brief Öncelik seviyesi başına hazır (ready) görev kuyrukları.
+ *
+ * Her seviye, SimulationTask içindeki rqNext/rqPrev alanlarıyla kurulan çift yönlü
+ * intrusive bir listedir; ek bellek ayrılmaz. Liste görev kimliğine (dosya sırası) göre
+ * sıralı tutulur, böylece baştaki görev eski doğrusal taramanın seçtiği en küçük
+ * indeksli görevdir (bkz. rqInsert). nonEmptyMask'in p. biti
+ * p seviyesinde en az bir görev olduğunu gösterir, böylece en yüksek öncelikli
+ * dolu seviye görev sayısından bağımsız olarak O(1) bulunur.
+ */
+typedef struct {
+    SimulationTask* head[READY_LEVELS];
+    SimulationTask* tail[READY_LEVELS];
+    unsigned int nonEmptyMask;
+    int count;  // Tüm seviyelerdeki toplam görev (çok çekirdekte yük ölçüsü)
+} ReadyQueues;
+
+/**
+ * @brief Tüm seviyeleri boşaltır.
+ */
+void rqInit(ReadyQueues* rq);
+
+/**
+ * @brief Görevi task->priority seviyesine kimlik sırasını koruyarak ekler.
+ *
+ * Sıra döngüseldir: kimliği after'dan büyük görevler artan sırayla önde, after'a eşit
+ * ya da küçük olanlar artan sırayla arkada durur. Round-Robin seviyesinde after en son
+ * seçilen görevin kimliğidir; baştaki görev o kimlikten sonraki ilk görev olur ve
+ * rqRotate döngüsel sırayı korur. Diğer seviyelerde after = -1 (düz artan sıra).
+ *
+ * Yer, sondan geriye yürünerek bulunur. Gelişler kimlik sırasıyla geldiğinden ve küçük
+ * kimlikler önce seçilip önce kademe düştüğünden ekleme çoğunlukla doğrudan sona olur;
+ * en kötü durumda seviyedeki görev sayısı kadar adım sürer.
+ *
+ * Seviye aralık dışındaysa (priority < 0 veya >= READY_LEVELS) görev kuyruğa alınmaz
+ * ve 0 döner; bu görevler hiç seçilmez (zaman aşımına kadar bekler).
+ *
+ * @return Kuyruğa eklendiyse 1, aksi halde 0
+ */
+int rqInsert(ReadyQueues* rq, SimulationTask* task, int after);
+
+/**
+ * @brief Görevi bulunduğu seviyeden O(1) çıkarır (kuyrukta değilse bir şey yapmaz).
+ *
+ * @param level Görevin kuyruğa eklendiği seviye
+ */
+void rqRemove(ReadyQueues* rq, SimulationTask* task, int level);
+
+/**
+ * @brief Verilen seviyenin başındaki görevi döndürür (boşsa NULL).
+ */
+SimulationTask* rqHead(const ReadyQueues* rq, int level);
+
+/**
+ * @brief En yüksek öncelikli (sayısal olarak en küçük) dolu seviyeyi döndürür, yoksa -1.
+ */
+int rqHighestLevel(const ReadyQueues* rq);
+
+/**
+ * @brief Seviyenin başındaki görevi kuyruğun sonuna taşır ve onu döndürür (Round-Robin).
+ */
+SimulationTask* rqRotate(ReadyQueues* rq, int level);
+
+/**
+ * @brief skip dışındaki en yüksek öncelikli görevi döndürür (yoksa NULL).
+ *
+ * İş çalma (work stealing) için: kurban çekirdeğin o an çalıştırdığı görev atlanır.
+ * En fazla bir eleman atlandığından maliyet O(seviye sayısı)'dır.
+ */
+SimulationTask* rqFirstExcept(const ReadyQueues* rq, const SimulationTask* skip);
+
+/**
+ * @brief from seviyesindeki tüm listeyi sırası korunarak to seviyesinin sonuna ekler.
+ *
+ * Yalnızca iki liste ucu bağlanır; maliyet görev sayısından bağımsız O(1)'dir. Taşınan
+ * görevlerin priority alanına dokunulmaz, çağıran yeni seviyeyi kendisi izlemelidir.
+ * Birleşen liste kimlik sırasında olmayabilir; sonraki rqInsert çağrıları yine sondan
+ * geriye yürüyerek kendinden büyük kimliklerin önüne geçer.
+ */
+void rqSplice(ReadyQueues* rq, int from, int to);
+
+#endif
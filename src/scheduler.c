@@ -1,324 +1,886 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <sys/resource.h>
 #include "scheduler.h"
-
-#define MAX_TASKS 100
-#define TIMEOUT_WINDOW 20  // Bir görevin (task) çalışır durumdayken en fazla bekleyebileceği süre penceresi (sn)
-
-SimulationTask taskList[MAX_TASKS];   // Simülasyondaki tüm görevlerin tutulduğu dizi
+#include "policy.h"
+#include "deadline_heap.h"
+#include "task_store.h"
+#include "trace_loader.h"
+#include "worker_pool.h"
+
+#define CONTROLLER_STACK_DEPTH 8192 // Controller görevinin yığını (sanal zamanda tick sinyalleri printf içine düşebiliyor)
+#define STREAM_READAHEAD 256 // Akış kipinde dosyadan önceden okunan (henüz gelmemiş) en fazla kayıt sayısı
+#define WORKER_POOL_PREWARM 8 // Gerçek zaman kipinde başlangıçta yaratılan boş işçi sayısı
+
+static TaskStore taskStore;           // Simülasyondaki tüm görevlerin tutulduğu parçalı arena (adresler sabit)
+static SimulationTask** arrivalOrder = NULL; // Görevlere geliş zamanına göre sıralı erişim dizisi
 int taskCount = 0;                   // Yüklenen toplam görev sayısı
-int globalTimer = 0;                 // Simülasyonun global zamanı (sn)
-
-static int lastRRIndex = -1;         // Priority=3 Round-Robin seçiminde en son seçilen index
+SimTime globalTimer = 0;             // Simülasyonun global zamanı (tick, bkz. sim_time.h)
+
+static int arrivalCursor = 0;        // arrivalOrder içinde henüz sisteme alınmamış ilk görev
+
+static const SchedPolicy* policy = &mlfqPolicy; // Seçim ve quantum sonu kararlarını veren politika (bkz. policy.h)
+static SimulationTask* coreCurrent[SIM_MAX_CORES]; // Bu quantum'da çekirdekte çalışan görev (NULL: boşta)
+static int coreCount = 1;            // Simüle edilen çekirdek sayısı
+static DeadlineHeap deadlineHeap;    // Sistemdeki bitmemiş görevler, en erken zaman aşımı en üstte
+static int virtualTimeMode = 0;      // 1 ise sanal zaman kipi (gerçek bekleme yok, FreeRTOS görevi yok)
+static WorkerPool workerPool;        // Gerçek zaman kipinde proseslere bağlanan FreeRTOS işçileri
+static int lightweightMode = 0;      // 1 ise prosesler yalnızca kayıttır; işçi sadece quantum süresince bağlanır
+static SimTime quantum = (SimTime)SIM_QUANTUM_MS * SIM_TICKS_PER_SEC / 1000; // Quantum süresi (tick)
+static SimTime coreSlice[SIM_MAX_CORES]; // Bu quantum'da çekirdekteki görevin çalıştığı süre (tick)
+static SimTime timeoutWindow = (SimTime)TIMEOUT_WINDOW * SIM_TICKS_PER_SEC; // Zaman aşımı penceresi (tick)
+static SchedulerCompletionHook completionHook = NULL; // Tamamlanan her görev için çağrılır (bkz. scheduler.h)
+
+// === Akış (streaming) kipi ===
+static int streamMode = 0;                        // 1 ise gelişler dosyadan tembel okunur
+static TraceReader streamReader;                  // Açık giriş dosyası
+static TraceRecord streamBuf[STREAM_READAHEAD];   // Ön okuma tamponu (henüz gelmemiş kayıtlar)
+static int streamHead = 0;                        // Tampondaki sıradaki kayıt
+static int streamLen = 0;                         // Tampondaki geçerli kayıt sayısı
+static SimTime streamLastArrival = INT64_MIN;     // Sıralılık kontrolü için son okunan geliş zamanı
 
 // === İstatistik sayaçları (özet rapor için) ===
 static int statDroppedTasks = 0;      // Zaman aşımı nedeniyle düşürülen görev sayısı
 static int statCompletedTasks = 0;    // Başarıyla tamamlanan görev sayısı
-static long statTotalTurnaround = 0;  // Toplam turnaround (tamamlanma) süresi birikimi
-static long statTotalWaiting = 0;     // Toplam bekleme süresi birikimi
+static SimTime statTotalTurnaround = 0; // Toplam turnaround (tamamlanma) süresi birikimi (tick)
+static SimTime statTotalWaiting = 0;  // Toplam bekleme süresi birikimi (tick)
+static double statProgressSum = 0;    // Tamamlanan görevlerde burst/turnaround toplamı (Jain indeksi için)
+static double statProgressSqSum = 0;  // Aynı oranların kareleri toplamı
+static SimTime statCoreBusy[SIM_MAX_CORES]; // Çekirdeğin görev çalıştırdığı süre (tick)
+static long statMigrations = 0;       // Çekirdekler arası çalınan (göç eden) görev sayısı
+static int statDeadlineTasks = 0;     // Deadline'ı olan (sisteme alınmış) görev sayısı
+static int statDeadlineMisses = 0;    // Deadline'ından sonra tamamlanan görev sayısı (düşenler zaman aşımında sayılır)
+static double statImbalanceSum = 0;   // Quantum başına (en yüklü / ideal) kuyruk uzunluğu oranı toplamı
+static long statImbalanceSamples = 0; // statImbalanceSum'a katılan quantum sayısı
 
 /**
- * @brief Görevleri dosyadan okuyup taskList dizisine yükler.
+ * @brief qsort karşılaştırıcısı (arrivalOrder elemanları): önce arrivalTime, eşitse dosya sırası (id).
  *
- * Dosya formatı: arrivalTime, priority, burstTime
- * - arrivalTime : Görevin sisteme giriş zamanı (sn)
- * - priority    : Öncelik seviyesi (0 en yüksek, 5 en düşük)
- * - burstTime   : Görevin toplam CPU ihtiyacı (sn)
+ * id benzersiz olduğundan sıralama kararlıdır (stable) ve deterministiktir.
+ */
+static int compareArrival(const void* a, const void* b) {
+    const SimulationTask* ta = *(SimulationTask* const*)a;
+    const SimulationTask* tb = *(SimulationTask* const*)b;
+
+    return taskArrivedBefore(ta, tb) ? -1 : taskArrivedBefore(tb, ta);
+}
+
+/**
+ * @brief Arenadan alınmış bir yuvayı dosyadaki kayıttan kurar.
  *
- * Okunan her görev için:
  * - id atanır
+ * - priority int16 aralığına sıkıştırılır (politikalar aralık dışını zaten uçtaki seviye gibi işler)
  * - remainingTime burstTime olarak başlatılır
  * - handle NULL yapılır (henüz FreeRTOS görevi yaratılmadı)
- * - deadline = arrivalTime + TIMEOUT_WINDOW olarak atanır (ilk zaman aşımı hedefi)
+ * - state TASK_STATE_PENDING yapılır (henüz sisteme gelmedi)
+ * - dueTime = arrivalTime + göreli deadline (dosyada deadline sütunu yoksa SIM_TIME_NEVER)
  * - name alanı "proses" yapılır
  */
+static void initTaskRecord(SimulationTask* task, const TraceRecord* record, int id) {
+    SimulationTaskCold* cold = getTaskCold(task);
+
+    // Temel alanları kur
+    cold->id = id;
+    cold->arrivalTime = record->arrivalTime;
+    task->priority = (int16_t)(record->priority < INT16_MIN ? INT16_MIN :
+        record->priority > INT16_MAX ? INT16_MAX : record->priority);
+    task->remainingTime = record->burstTime;
+
+    task->state = TASK_STATE_PENDING;
+    task->heapIndex = -1;
+    task->policyKey = 0;
+
+    // Kuyruk bağları ile policyIndex aynı baytlardır: policyIndex -1 rqNext'in yarısını
+    // doldurur, MLFQ ise üyeliği rqPrev/seviye başına bakarak anlar ve bağları eklemede kurar
+    task->rqNext = NULL;
+    task->rqPrev = NULL;
+    task->policyIndex = -1;
+
+    cold->burstTime = record->burstTime;
+
+    // Mutlak deadline: dosyada göreli olarak verilir (sütun yoksa hiç dolmaz)
+    cold->dueTime = record->deadline != TRACE_NO_DEADLINE ? record->arrivalTime + record->deadline : SIM_TIME_NEVER;
+
+    // FreeRTOS görevi henüz oluşturulmadığı için handle NULL
+    cold->handle = NULL;
+
+    // arrivalTimestamp: görevin gerçekten sisteme alındığı zaman (oluşturulduğu an)
+    cold->arrivalTimestamp = -1;
+
+    // hasStarted: ilk kez CPU görüp görmediğini loglamak için bayrak
+    task->hasStarted = 0;
+
+    // Görev ismi (FreeRTOS tarafında kullanılacak)
+    strcpy(cold->name, "proses");
+}
+
+/**
+ * @brief Görevleri dosyadan okuyup görev arenasına (taskStore) yükler.
+ *
+ * Dosya formatı: arrivalTime, priority, burstTime
+ * - arrivalTime : Görevin sisteme giriş zamanı (sn)
+ * - priority    : Öncelik seviyesi (0 en yüksek, 5 en düşük)
+ * - burstTime   : Görevin toplam CPU ihtiyacı (sn)
+ *
+ * Dosya mmap ile eşlenip trace_loader ile ayrıştırılır; hatalı satırda satır
+ * numarasıyla hata verilir (bkz. trace_loader.h).
+ *
+ * Okunan her görev initTaskRecord ile kurulur.
+ *
+ * Görev sayısında üst sınır yoktur; kayıtlar arenada dosya sırasıyla durur ve yerleri
+ * hiç değişmez. Okuma bittikten sonra arrivalOrder dizisi geliş zamanına göre sıralanır;
+ * aynı anda gelen görevler dosyadaki sıralarını (id) korur. Scheduler gelişleri bu sıra
+ * üzerinde ilerleyen bir imleçle (arrivalCursor) sisteme alır.
+ */
 void loadTasks(const char* filename) {
-    FILE *file = fopen(filename, "r");
-    if (!file) {
-        printf("Hata: %s dosyasi acilamadi.\n", filename);
+    TraceReader reader;
+    TraceRecord record;
+
+    trOpen(&reader, filename);
+    tsInit(&taskStore);
+
+    // Dosyadan satır satır görevleri oku (sınır yok, arena gerektikçe büyür)
+    while (trNext(&reader, &record)) {
+        SimulationTask* task = tsAlloc(&taskStore);
+        initTaskRecord(task, &record, taskStore.count - 1);
+    }
+
+    trClose(&reader);
+
+    taskCount = taskStore.count;
+
+    // Geliş sırası dizisi (görev sayısı artık belli olduğundan tek seferde ayrılır)
+    arrivalOrder = malloc((size_t)(taskCount > 0 ? taskCount : 1) * sizeof(SimulationTask*));
+    if (!arrivalOrder) {
+        printf("Hata: gelis sirasi icin bellek ayrilamadi.\n");
         exit(1);
     }
+    for (int i = 0; i < taskCount; i++) {
+        arrivalOrder[i] = tsAt(&taskStore, i);
+    }
 
-    taskCount = 0;
+    qsort(arrivalOrder, taskCount, sizeof(SimulationTask*), compareArrival);
+    arrivalCursor = 0;
+}
 
-    // Dosyadan satır satır görevleri oku (MAX_TASKS sınırı var)
-    while (taskCount < MAX_TASKS &&
-        fscanf(file, "%d, %d, %d",
-            &taskList[taskCount].arrivalTime,
-            &taskList[taskCount].priority,
-            &taskList[taskCount].burstTime) == 3) {
+/**
+ * @brief Akış kipinde sıradaki (henüz gelmemiş) kaydı döndürür; dosya bittiyse NULL.
+ *
+ * Tampon boşaldığında dosyadan en fazla STREAM_READAHEAD kayıt okunur. Kayıtların
+ * geliş zamanına göre sıralı olması gerekir; aksi halde satır numarasıyla hata verilir.
+ */
+static TraceRecord* streamPeek(void) {
+    if (streamHead < streamLen) {
+        return &streamBuf[streamHead];
+    }
 
-        // Temel alanları kur
-        taskList[taskCount].id = taskCount;
-        taskList[taskCount].remainingTime = taskList[taskCount].burstTime;
+    streamHead = 0;
+    streamLen = 0;
+    while (streamLen < STREAM_READAHEAD && trNext(&streamReader, &streamBuf[streamLen])) {
+        if (streamBuf[streamLen].arrivalTime < streamLastArrival) {
+            printf("Hata: %s:%d: akis kipinde gorevler gelis zamanina gore sirali olmali.\n",
+                streamReader.path, streamReader.line);
+            exit(1);
+        }
+        streamLastArrival = streamBuf[streamLen].arrivalTime;
+        streamLen++;
+    }
 
-        // FreeRTOS görevi henüz oluşturulmadığı için handle NULL
-        taskList[taskCount].handle = NULL;
+    return streamLen > 0 ? &streamBuf[0] : NULL;
+}
 
-        // arrivalTimestamp: görevin gerçekten sisteme alındığı zaman (oluşturulduğu an)
-        taskList[taskCount].arrivalTimestamp = -1;
+/**
+ * @brief Henüz sisteme alınmamış görev kaldı mı?
+ */
+static int hasPendingArrivals(void) {
+    if (streamMode) {
+        return streamPeek() != NULL;
+    }
+    return arrivalCursor < taskCount;
+}
 
-        // hasStarted: ilk kez CPU görüp görmediğini loglamak için bayrak
-        taskList[taskCount].hasStarted = 0;
+/**
+ * @brief Simülasyon veri yapılarının kullandığı toplam bellek (bayt).
+ *
+ * Görev arenası + geliş sırası dizisi (yalnızca tam yüklemede) + deadline heap dizisi.
+ */
+static size_t schedulerMemoryUsage(void) {
+    return tsMemoryUsage(&taskStore) +
+        (arrivalOrder != NULL ? (size_t)taskCount * sizeof(SimulationTask*) : 0) +
+        (size_t)deadlineHeap.capacity * sizeof(SimulationTask*);
+}
 
-        // Zaman aşımı hedefi: (ilk kurulumda) arrivalTime + TIMEOUT_WINDOW
-        taskList[taskCount].deadline = taskList[taskCount].arrivalTime + TIMEOUT_WINDOW;
+/**
+ * @brief Kuyruğunda en az görev bulunan çekirdek (eşitlikte en küçük numara).
+ */
+static int leastLoadedCore(void) {
+    int best = 0;
+    for (int c = 1; c < coreCount; c++) {
+        if (policy->load(c) < policy->load(best)) {
+            best = c;
+        }
+    }
+    return best;
+}
 
-        // Görev ismi (FreeRTOS tarafında kullanılacak)
-        strcpy(taskList[taskCount].name, "proses");
+/**
+ * @brief Görevi sisteme alır (geliş anı).
+ *
+ * Gerçek zaman kipinde göreve havuzdan boşta bir FreeRTOS işçisi bağlanır (havuz boşsa
+ * yenisi yaratılır). Sanal zaman ve hafif proses kiplerinde görev yalnızca veri kaydıdır.
+ * İlk zaman aşımı hedefi arrivalTime + zaman aşımı penceresidir; pencere yüklemeden sonra
+ * da değiştirilebildiği için (parametre taraması) burada atanır.
+ */
+static void admitTask(SimulationTask* task) {
+    SimulationTaskCold* cold = getTaskCold(task);
 
-        taskCount++;
+    if (!virtualTimeMode && !lightweightMode) {
+        cold->handle = wpAcquire(&workerPool);
     }
 
-    fclose(file);
+    task->state = TASK_STATE_READY;
+    task->deadline = cold->arrivalTime + timeoutWindow;
+
+    // Çalışacak işi olan görev politikanın hazır kümesine (MLFQ: kendi seviyesi) girer
+    // ve zaman aşımı takibi için deadline heap'ine eklenir
+    if (task->remainingTime > 0) {
+        task->core = (unsigned char)leastLoadedCore();
+        policy->on_arrival(task->core, task);
+        dhPush(&deadlineHeap, task);
+    }
+
+    if (cold->dueTime != SIM_TIME_NEVER) {
+        statDeadlineTasks++;
+    }
+
+    // Görevin sisteme alındığı gerçek zaman damgası
+    cold->arrivalTimestamp = globalTimer;
+
+    // İlk kez CPU görecek (log için)
+    task->hasStarted = 0;
+}
+
+/**
+ * @brief Görevi sistemden kaldırır (tamamlanma ya da zaman aşımı).
+ *
+ * @param task     Kaldırılacak görev
+ * @param endState TASK_STATE_FINISHED veya TASK_STATE_DROPPED
+ */
+static void retireTask(SimulationTask* task, SimTaskState endState) {
+    if (endState == TASK_STATE_FINISHED) {
+        policy->on_complete(task->core, task);
+    }
+    else {
+        // Log politika görevi çıkardıktan sonra basılır (MLFQ yükseltmesi seviyeyi tembel günceller)
+        policy->on_timeout(task->core, task);
+        printTaskLog(task, TASK_LOG_TIMEOUT);
+    }
+    dhRemove(&deadlineHeap, task);
+
+    SimulationTaskCold* cold = getTaskCold(task);
+
+    // İşçi silinmez, sonraki gelişe bağlanmak üzere havuza döner
+    if (cold->handle != NULL) {
+        wpRelease(&workerPool, cold->handle);
+        cold->handle = NULL;
+    }
+    task->state = endState;
+
+    // Akış kipinde kayıt bir daha okunmaz; yuvası sonraki gelişe verilir
+    if (streamMode) {
+        tsRelease(&taskStore, task);
+    }
+}
+
+/**
+ * @brief Simülasyon süresini FreeRTOS tick'ine çevirir (en az 1 tick).
+ *
+ * FreeRTOS tick'inden kısa süreler (örn. 0.5 ms quantum) gerçek zaman kipinde bir
+ * tick'e yuvarlanır; simülasyon saati bundan etkilenmez.
+ */
+static TickType_t toRtosTicks(SimTime t) {
+    TickType_t ticks = (TickType_t)(t * configTICK_RATE_HZ / SIM_TICKS_PER_SEC);
+    return ticks > 0 ? ticks : 1;
+}
+
+/**
+ * @brief Çekirdeklerde seçilen görevleri bir quantum boyunca birlikte çalıştırır.
+ *
+ * Gerçek zaman kipinde her görevin işçisine, çalışacağı dilim (coreSlice) bildirim
+ * değeri olarak doğrudan verilir (xTaskNotify) ve controller, tüm işçiler quantum
+ * sonunu bildirene kadar ulTaskNotifyTake ile bloklanır; işçiler quantum'u aynı anda geçirir. Eski
+ * resume -> delay -> suspend dizisinin aksine kernel'in suspend listelerine dokunulmaz.
+ * Hafif proses kipinde işçiler yalnızca bu quantum için havuzdan alınır.
+ * Sanal zaman kipinde beklenmez; quantum sonu olayı anında gerçekleşir.
+ */
+static void runQuanta(void) {
+    TaskHandle_t workers[SIM_MAX_CORES];
+    TickType_t slices[SIM_MAX_CORES];
+    int n = 0;
+
+    if (virtualTimeMode) {
+        return;
+    }
+
+    for (int c = 0; c < coreCount; c++) {
+        if (coreCurrent[c] != NULL) {
+            slices[n] = toRtosTicks(coreSlice[c]);
+            workers[n++] = lightweightMode ? wpAcquire(&workerPool) : getTaskCold(coreCurrent[c])->handle;
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        xTaskNotify(workers[i], (uint32_t)slices[i], eSetValueWithOverwrite);
+    }
+    // Her işçi bir onay verir; sayaç birer birer tüketilir
+    for (int i = 0; i < n; i++) {
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    }
+
+    if (lightweightMode) {
+        for (int i = 0; i < n; i++) {
+            wpRelease(&workerPool, workers[i]);
+        }
+    }
+}
+
+/**
+ * @brief Geliş zamanı gelmiş (arrivalTime <= globalTimer) tüm görevleri sisteme alır.
+ *
+ * arrivalOrder geliş zamanına göre sıralı olduğundan imleç yalnızca ileri gider; maliyet
+ * yeni gelen görev sayısı kadardır. Zaman birden fazla birim atlasa bile arada kalan
+ * gelişler kaçırılmaz. Akış kipinde aynı işi ön okuma tamponu görür: gelen kayıt için
+ * arenadan (varsa geri verilmiş) bir yuva alınır.
+ */
+static void admitArrivals(void) {
+    if (streamMode) {
+        TraceRecord* record;
+        while ((record = streamPeek()) != NULL && record->arrivalTime <= globalTimer) {
+            SimulationTask* task = tsAlloc(&taskStore);
+            initTaskRecord(task, record, taskCount++);
+            streamHead++;
+            admitTask(task);
+        }
+        return;
+    }
+
+    while (arrivalCursor < taskCount && getTaskCold(arrivalOrder[arrivalCursor])->arrivalTime <= globalTimer) {
+        admitTask(arrivalOrder[arrivalCursor]);
+        arrivalCursor++;
+    }
 }
 
 /**
- * @brief Tüm aktif görevleri dolaşır ve zaman aşımına uğrayanları düşürür.
+ * @brief CPU boşta iken bir sonraki olayın zamanını hesaplar.
+ *
+ * Boşta iken durumu değiştirebilecek olaylar yalnızca yeni gelişler ve zaman aşımlarıdır
+ * (en erken zaman aşımı deadline heap'inin tepesindedir).
+ * Sonuç globalTimer'dan büyüktür; hiç olay yoksa (ya da olay geçmişte kalmışsa)
+ * globalTimer + quantum döner. Her iki zaman kipi de boşta bu zamana atlar.
+ */
+static SimTime nextIdleEventTime(void) {
+    SimTime next = INT64_MAX;
+
+    // Sıradaki geliş: imlecin (akış kipinde ön okuma tamponunun) gösterdiği görev
+    if (streamMode) {
+        TraceRecord* record = streamPeek();
+        if (record != NULL) {
+            next = record->arrivalTime;
+        }
+    }
+    else if (arrivalCursor < taskCount) {
+        next = getTaskCold(arrivalOrder[arrivalCursor])->arrivalTime;
+    }
+
+    SimulationTask* earliest = dhPeek(&deadlineHeap);
+    if (earliest != NULL && earliest->deadline < next) {
+        next = earliest->deadline;
+    }
+
+    if (next <= globalTimer || next == INT64_MAX) {
+        next = globalTimer + quantum;
+    }
+    return next;
+}
+
+/**
+ * @brief Zaman aşımına uğrayan aktif görevleri düşürür.
  *
  * Kural:
- * - Görev "aktif" sayılabilmesi için handle != NULL olmalı
- * - remainingTime > 0 ise tamamlanmamış demektir
+ * - Deadline heap'inde yalnızca sisteme alınmış ve bitmemiş görevler bulunur
  * - globalTimer >= deadline ise zaman aşımı kabul edilir
  *
+ * Heap'in tepesi en erken deadline olduğundan yalnızca süresi dolan görevlere
+ * dokunulur (maliyet O(dolan görev * log n), görev sayısından bağımsız).
+ *
  * Zaman aşımında:
- * - log basılır ("zamanaşımı")
+ * - log basılır ("zamanaşımı", retireTask içinde)
  * - dropped istatistiği artırılır
- * - FreeRTOS görevi silinir, handle NULL yapılır
+ * - FreeRTOS işçisi (varsa) havuza döner, handle NULL yapılır (retireTask heap'ten de çıkarır)
  */
 static void checkGlobalTimeouts(void) {
-    for (int i = 0; i < taskCount; i++) {
-        if (taskList[i].handle != NULL && taskList[i].remainingTime > 0) {
-            if (globalTimer >= taskList[i].deadline) {
-                printTaskLog(&taskList[i], "zamanaşımı");
+    SimulationTask* task;
 
-                statDroppedTasks++;
+    while ((task = dhPeek(&deadlineHeap)) != NULL && globalTimer >= task->deadline) {
+        statDroppedTasks++;
 
-                vTaskDelete(taskList[i].handle);
-                taskList[i].handle = NULL;
-            }
-        }
+        retireTask(task, TASK_STATE_DROPPED);
     }
 }
 
 /**
- * @brief Sıradaki çalıştırılacak görevi seçer.
+ * @brief Boşta kalan thief çekirdeği için başka bir çekirdekten görev çalar.
  *
- * Seçim politikası (koddaki sıraya göre):
- * 1) Priority 0: Bulur bulmaz döner (en yüksek öncelik)
- * 2) Priority 1-2: Önce 1 sonra 2 taranır, ilk uygun görev seçilir
- * 3) Priority 3: Round-Robin mantığıyla (lastRRIndex üzerinden) döngüsel seçim
- * 4) Priority 4-5: Önce 4 sonra 5 taranır
+ * Kurban, çalışmayan (bekleyen) görevi en çok olan çekirdektir; hangi görevin alınacağına
+ * politika karar verir (MLFQ'da çalışmayan en yüksek öncelikli görev). Görev thief'in
+ * hazır kümesine girer ve bu quantum'da orada çalışır.
  *
- * Uygunluk koşulları:
- * - handle != NULL (görev oluşturulmuş ve silinmemiş)
- * - remainingTime > 0 (bitmemiş)
- * - priority eşleşiyor
- *
- * @return Seçilen görevin adresi, yoksa NULL
+ * @return Çalınan görev, çalınacak görev yoksa NULL
  */
-static SimulationTask* selectNextTask(void) {
-    // 1) Priority 0 (en kritik)
-    for (int i = 0; i < taskCount; i++) {
-        if (taskList[i].handle != NULL &&
-            taskList[i].remainingTime > 0 &&
-            taskList[i].priority == 0) {
-            return &taskList[i];
+static SimulationTask* stealTask(int thief) {
+    int victim = -1;
+    int most = 0;
+
+    for (int c = 0; c < coreCount; c++) {
+        int waiting = policy->load(c) - (coreCurrent[c] != NULL ? 1 : 0);
+        if (waiting > most) {
+            most = waiting;
+            victim = c;
         }
     }
+    if (victim < 0) {
+        return NULL;
+    }
 
-    // 2) Priority 1-2 (sıralı tarama)
-    for (int p = 1; p <= 2; p++) {
-        for (int i = 0; i < taskCount; i++) {
-            if (taskList[i].handle != NULL &&
-                taskList[i].remainingTime > 0 &&
-                taskList[i].priority == p) {
-                return &taskList[i];
-            }
-        }
+    SimulationTask* task = policy->steal(victim, coreCurrent[victim]);
+    if (task == NULL) {
+        return NULL;
     }
+    task->core = (unsigned char)thief;
+    policy->on_arrival(thief, task);
+    statMigrations++;
+    return task;
+}
 
-    // 3) Priority 3 (Round-Robin)
-    // lastRRIndex'ten sonraki elemandan başlayarak döngüsel arar
-    for (int k = 0; k < taskCount; k++) {
-        int idx = (lastRRIndex + 1 + k) % taskCount;
-        if (taskList[idx].handle != NULL &&
-            taskList[idx].remainingTime > 0 &&
-            taskList[idx].priority == 3) {
-            lastRRIndex = idx;   // RR için "en son seçilen" index güncellenir
-            return &taskList[idx];
+/**
+ * @brief Süresi seçimden önce dolmuş görevleri düşürür ve yalnızca onların çekirdeklerinde yeniden seçer.
+ *
+ * Düşürülen görev CPU görmez. Seçimi geçerli olan çekirdeklere dokunulmaz: pick_next'in
+ * yan etkileri (Round-Robin dönüşü, piyango çekilişi) ve yapılmış çalmalar tekrarlanmaz.
+ * Yeni seçilen görevin de süresi dolmuşsa işlem tekrarlanır.
+ */
+static void repickExpired(void) {
+    for (;;) {
+        uint64_t expired = 0;
+        for (int c = 0; c < coreCount; c++) {
+            if (coreCurrent[c] != NULL && globalTimer >= coreCurrent[c]->deadline) {
+                expired |= 1ull << c;
+            }
+        }
+        if (expired == 0) {
+            return;
         }
-    }
 
-    // 4) Priority 4-5 (en düşük öncelikler)
-    for (int p = 4; p <= 5; p++) {
-        for (int i = 0; i < taskCount; i++) {
-            if (taskList[i].handle != NULL &&
-                taskList[i].remainingTime > 0 &&
-                taskList[i].priority == p) {
-                return &taskList[i];
+        checkGlobalTimeouts();
+        for (int c = 0; c < coreCount; c++) {
+            if (expired & (1ull << c)) {
+                coreCurrent[c] = NULL;
+            }
+        }
+        for (int c = 0; c < coreCount; c++) {
+            if (expired & (1ull << c)) {
+                coreCurrent[c] = policy->pick_next(c);
+                if (coreCurrent[c] == NULL) {
+                    coreCurrent[c] = stealTask(c);
+                }
             }
         }
     }
+}
 
-    // Çalıştırılacak görev yok
-    return NULL;
+/**
+ * @brief Quantum başında çekirdek kuyruklarının dengesizliğini örnekler.
+ *
+ * Oran = en yüklü kuyruk / ideal kuyruk (toplam görevin çekirdeklere eşit bölünmesi,
+ * yukarı yuvarlanmış). Görevler tam dengeli dağıldığında 1.00'dır.
+ */
+static void sampleLoadImbalance(void) {
+    int total = 0;
+    int most = 0;
+
+    for (int c = 0; c < coreCount; c++) {
+        int load = policy->load(c);
+        total += load;
+        if (load > most) {
+            most = load;
+        }
+    }
+    if (total > 0) {
+        int ideal = (total + coreCount - 1) / coreCount;
+        statImbalanceSum += (double)most / ideal;
+        statImbalanceSamples++;
+    }
 }
 
 /**
- * @brief Ana zamanlayıcı (scheduler/controller) görevi.
+ * @brief Controller'ın bir adımı (bkz. scheduler.h).
  *
- * Bu görev:
- * 1) Her saniye (globalTimer adımında) arrivalTime == globalTimer olan görevleri oluşturur.
- *    - xTaskCreate ile FreeRTOS görevi yaratılır
- *    - hemen suspend edilir (kontrol scheduler’da olsun diye)
- * 2) selectNextTask() ile çalıştırılacak görevi seçer.
- * 3) Seçilen görevi 1 saniye çalıştırır:
- *    - resume -> 1 saniye delay -> suspend
- *    - globalTimer++ ve remainingTime--
- * 4) Görev bittiğinde istatistikleri hesaplar ve görevi siler.
+ * 1) arrivalTime <= globalTimer olan yeni görevleri (geliş imleciyle) sisteme alır.
+ *    - gerçek zaman kipinde işçi havuzundan bir FreeRTOS görevi bağlanır
+ *      (işçi, scheduler bildirim verene kadar bloklu bekler)
+ * 2) Her çekirdek politikanın pick_next kancasıyla kendi kümesinden görev seçer; kümesi boş olan
+ *    çekirdek stealTask() ile en yüklü çekirdekten görev çalar.
+ * 3) Seçilen görevleri bir quantum birlikte çalıştırır (kalan süresi quantum'dan kısa olan
+ *    görev yalnızca kalan süresi kadar çalışır):
+ *    - işçilere bildirim -> işçilerin quantum sonu bildirimi (sanal zaman kipinde beklenmez)
+ *    - globalTimer en uzun dilim kadar ilerler, remainingTime dilim kadar azalır
+ * 4) Görev bittiğinde istatistikleri hesaplar ve işçisini havuza geri verir.
  * 5) Bitmediyse deadline’ı günceller ve (kurala göre) bazı görevlerde priority artırır.
- * 6) Görev yoksa 1 saniye bekleyip globalTimer artırır ve timeout kontrolü yapar.
- * 7) Tüm görevler bittiğinde özet rapor basar ve programı sonlandırır.
+ * 6) Görev yoksa timeout kontrolü yapar ve globalTimer'ı bir sonraki olaya atlatır
+ *    (gerçek zaman kipinde aradaki süre kadar beklenir).
+ *
+ * FreeRTOS çağrıları (runQuanta, vTaskDelay) yalnızca gerçek zaman kipinde yapılır.
  */
-void vSchedulerTask(void* pvParameters) {
-    (void)pvParameters;
-
-    for (;;) {
+int xSchedulerStep(void) {
+    // 1) Yeni gelen görevleri (arrivalTime <= globalTimer) oluştur
+    admitArrivals();
 
-        // 1) Yeni gelen görevleri (arrivalTime == globalTimer) oluştur
-        for (int i = 0; i < taskCount; i++) {
-            if (taskList[i].arrivalTime == globalTimer) {
+    // 2) Her çekirdek kendi kuyruğundan seçer; kuyruğu boş kalan çekirdekler
+    //    en yüklü çekirdekten çalar
+    int running = 0;
 
-                // Görevi oluştur (vTaskGenericFunction görevi çalıştıracak genel fonksiyon)
-                xTaskCreate(vTaskGenericFunction,
-                    taskList[i].name,
-                    128,
-                    &taskList[i],
-                    1,
-                    &taskList[i].handle);
-
-                // Scheduler kontrolü ele almak için hemen durdur
-                vTaskSuspend(taskList[i].handle);
-
-                // Görevin sisteme alındığı gerçek zaman damgası
-                taskList[i].arrivalTimestamp = globalTimer;
-
-                // İlk kez CPU görecek (log için)
-                taskList[i].hasStarted = 0;
-            }
+    for (int c = 0; c < coreCount; c++) {
+        coreCurrent[c] = policy->pick_next(c);
+    }
+    for (int c = 0; c < coreCount; c++) {
+        if (coreCurrent[c] == NULL) {
+            coreCurrent[c] = stealTask(c);
         }
+    }
+    repickExpired();
 
-        // 2) Sıradaki görevi seç
-        SimulationTask* current = selectNextTask();
+    for (int c = 0; c < coreCount; c++) {
+        if (coreCurrent[c] != NULL) {
+            running++;
+        }
+    }
 
-        if (current != NULL) {
+    if (running > 0) {
+        if (coreCount > 1) {
+            sampleLoadImbalance();
+        }
 
-            // İlk kez çalışıyorsa "başladı", değilse "yürütülüyor"
+        // İlk kez çalışıyorsa "başladı", değilse "yürütülüyor"
+        for (int c = 0; c < coreCount; c++) {
+            SimulationTask* current = coreCurrent[c];
+            if (current == NULL) {
+                continue;
+            }
             if (current->hasStarted == 0) {
-                printTaskLog(current, "başladı");
+                printTaskLog(current, TASK_LOG_STARTED);
                 current->hasStarted = 1;
             }
             else {
-                printTaskLog(current, "yürütülüyor");
+                printTaskLog(current, TASK_LOG_RUNNING);
+            }
+        }
+
+        // 3) Çalıştırmadan önce tüm görevlerde timeout kontrolü
+        checkGlobalTimeouts();
+
+        // 4) Seçilen görevleri bir quantum çalıştır; çekirdekler aynı quantum
+        //    sınırında buluşur (erken biten görevin çekirdeği sınıra kadar boşta kalır)
+        SimTime start = globalTimer;
+        SimTime step = 0;
+
+        for (int c = 0; c < coreCount; c++) {
+            if (coreCurrent[c] != NULL) {
+                SimTime limit = policy->time_slice != NULL ? policy->time_slice(c, coreCurrent[c]) : quantum;
+                coreSlice[c] = coreCurrent[c]->remainingTime < limit ? coreCurrent[c]->remainingTime : limit;
+                if (coreSlice[c] > step) {
+                    step = coreSlice[c];
+                }
             }
+        }
 
-            // 3) Çalıştırmadan önce tüm görevlerde timeout kontrolü
-            checkGlobalTimeouts();
+        runQuanta();
 
-            // 4) Seçilen görevi 1 saniye çalıştır (quantum = 1 sn)
-            vTaskResume(current->handle);
-            vTaskDelay(pdMS_TO_TICKS(1000));
-            vTaskSuspend(current->handle);
+        // Zaman ilerlet ve görev sürelerini düş
+        globalTimer += step;
 
-            // Zaman ilerlet ve görev süresini düş
-            globalTimer++;
-            current->remainingTime--;
+        for (int c = 0; c < coreCount; c++) {
+            SimulationTask* current = coreCurrent[c];
+            if (current == NULL) {
+                continue;
+            }
+            statCoreBusy[c] += coreSlice[c];
+            current->remainingTime -= coreSlice[c];
+            if (policy->account != NULL) {
+                policy->account(c, current, coreSlice[c]);
+            }
 
             // 5) Görev tamamlandı mı?
             if (current->remainingTime <= 0) {
-                printTaskLog(current, "sonlandı");
+                printTaskLog(current, TASK_LOG_FINISHED);
 
-                // === İstatistikler ===
+                // === İstatistikler (toplam süre ve deadline soğuk kayıttan) ===
+                const SimulationTaskCold* cold = getTaskCold(current);
                 statCompletedTasks++;
-                int turnaround = globalTimer - current->arrivalTime; // tamamlanma - geliş
-                int waiting = turnaround - current->burstTime;       // turnaround - CPU ihtiyacı
+                SimTime turnaround = start + coreSlice[c] - cold->arrivalTime; // tamamlanma - geliş
+                SimTime waiting = turnaround - cold->burstTime;                    // turnaround - CPU ihtiyacı
 
                 statTotalTurnaround += turnaround;
                 statTotalWaiting += waiting;
+                if (turnaround > 0) {
+                    double progress = (double)cold->burstTime / (double)turnaround;
+                    statProgressSum += progress;
+                    statProgressSqSum += progress * progress;
+                }
+                if (cold->arrivalTime + turnaround > cold->dueTime) {
+                    statDeadlineMisses++;
+                }
+                if (completionHook != NULL) {
+                    completionHook(turnaround, waiting);
+                }
 
                 // Görevi sistemden kaldır
-                vTaskDelete(current->handle);
-                current->handle = NULL;
+                retireTask(current, TASK_STATE_FINISHED);
             }
             else {
                 // 6) Bitmediyse deadline’ı “şu andan itibaren” tekrar ayarla
-                current->deadline = globalTimer + TIMEOUT_WINDOW;
+                current->deadline = globalTimer + timeoutWindow;
+                dhUpdate(&deadlineHeap, current);
 
-                // 7) Priority artırma kuralı:
-                // 0 < priority < 5 ise bir kademe düşür (sayısal olarak artırılıyor)
-                if (current->priority > 0 && current->priority < 5) {
-                    current->priority++;
-                    printTaskLog(current, "askıda"); // preempt edildi / beklemeye alındı
+                // 7) Quantum sonu kararı politikada (MLFQ: 0 < priority < 5 ise bir kademe düşer)
+                if (policy->on_quantum_expired(c, current, coreSlice[c])) {
+                    printTaskLog(current, TASK_LOG_SUSPENDED); // preempt edildi / beklemeye alındı
                 }
             }
-
         }
-        else {
-            // Çalışacak görev yoksa:
-            // - timeout kontrolü yap
-            // - 1 saniye bekle ve zamanı ilerlet
-            checkGlobalTimeouts();
-            vTaskDelay(pdMS_TO_TICKS(1000));
-            globalTimer++;
+    }
+    else {
+        // Çalışacak görev yoksa:
+        // - timeout kontrolü yap
+        // - bir sonraki olaya kadar bekle ve zamanı ilerlet (sanal zamanda beklenmez)
+        checkGlobalTimeouts();
+        SimTime next = nextIdleEventTime();
+        if (!virtualTimeMode) {
+            vTaskDelay(toRtosTicks(next - globalTimer));
         }
+        globalTimer = next;
+    }
+
+    // 8) Simülasyonun bitiş koşulu:
+    // - Henüz sisteme alınmamış görev varsa bitmez
+    // - Aktif ve remainingTime>0 görev varsa bitmez (bunların hepsi deadline heap'indedir)
+    return hasPendingArrivals() || deadlineHeap.size > 0;
+}
 
-        // 8) Simülasyonun bitiş koşulu:
-        // - Henüz gelmemiş görev varsa bitmez
-        // - Aktif ve remainingTime>0 görev varsa bitmez
-        int allDone = 1;
-        for (int i = 0; i < taskCount; i++) {
-            if (taskList[i].arrivalTime > globalTimer) { allDone = 0; break; }
-            if (taskList[i].handle != NULL && taskList[i].remainingTime > 0) { allDone = 0; break; }
+/**
+ * @brief Simülasyon sonunda özet raporu basar.
+ */
+static void printSummary(void) {
+    logFlush(); // Özet, halkada bekleyen tüm log satırlarından sonra gelmeli
+
+    printf("\nSimulasyon Tamamlandi.\n");
+    printf("--------------------------------------------------\n");
+    printf("             SIMULATION SUMMARY                   \n");
+    printf("--------------------------------------------------\n");
+    char totalTime[32];
+    simFormatSeconds(totalTime, sizeof(totalTime), globalTimer);
+    printf("Scheduling Policy      : %s\n", policy->name);
+    printf("Total Simulation Time  : %s seconds\n", totalTime);
+    printf("Total Tasks Processed  : %d\n", taskCount);
+    printf("Tasks Completed        : %d\n", statCompletedTasks);
+    printf("Tasks Dropped (Timeout): %d\n", statDroppedTasks);
+    if (statDeadlineTasks > 0) {
+        printf("Deadline Misses        : %d / %d\n", statDeadlineMisses, statDeadlineTasks);
+    }
+    printf("Task Memory Used       : %.1f KB\n", schedulerMemoryUsage() / 1024.0);
+    printf("Peak Task Slots        : %d\n", taskStore.count);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    printf("Peak RSS               : %ld KB\n", usage.ru_maxrss);
+    if (coreCount > 1) {
+        printf("CPU Cores              : %d\n", coreCount);
+        for (int c = 0; c < coreCount; c++) {
+            printf("Core %-2d Utilization    : %.1f%%\n", c,
+                globalTimer > 0 ? 100.0 * (double)statCoreBusy[c] / (double)globalTimer : 0.0);
         }
+        printf("Task Migrations        : %ld\n", statMigrations);
+        printf("Load Imbalance (max/ideal): %.2f\n",
+            statImbalanceSamples > 0 ? statImbalanceSum / statImbalanceSamples : 1.0);
+    }
+    if (!virtualTimeMode) {
+        printf("Worker Pool Hit Rate   : %.1f%% (%lu/%lu)\n",
+            wpHitRate(&workerPool) * 100.0, workerPool.hits, workerPool.acquires);
+        printf("Peak Worker Pool Size  : %d\n", workerPool.size);
+    }
+    if (policy->report != NULL) {
+        policy->report();
+    }
+    if (logPolicy() == LOG_OVERFLOW_DROP) {
+        printf("Log Records Dropped    : %lu\n", logDroppedCount());
+    }
 
-        // 9) Bitmişse özet rapor bas ve çık
-        if (allDone) {
-            printf("\nSimulasyon Tamamlandi.\n");
-            printf("--------------------------------------------------\n");
-            printf("             SIMULATION SUMMARY                   \n");
-            printf("--------------------------------------------------\n");
-            printf("Total Simulation Time  : %d seconds\n", globalTimer);
-            printf("Total Tasks Processed  : %d\n", taskCount);
-            printf("Tasks Completed        : %d\n", statCompletedTasks);
-            printf("Tasks Dropped (Timeout): %d\n", statDroppedTasks);
-
-            if (statCompletedTasks > 0) {
-                double avgTurnaround = (double)statTotalTurnaround / statCompletedTasks;
-                double avgWaiting = (double)statTotalWaiting / statCompletedTasks;
-
-                printf("Avg Turnaround Time    : %.2f sec\n", avgTurnaround);
-                printf("Avg Waiting Time       : %.2f sec\n", avgWaiting);
-            }
-            else {
-                printf("Avg Turnaround Time    : N/A\n");
-                printf("Avg Waiting Time       : N/A\n");
-            }
-            printf("--------------------------------------------------\n");
+    if (statCompletedTasks > 0) {
+        double avgTurnaround = simToSeconds(statTotalTurnaround) / statCompletedTasks;
+        double avgWaiting = simToSeconds(statTotalWaiting) / statCompletedTasks;
 
-            exit(0);
-        }
+        printf("Avg Turnaround Time    : %.2f sec\n", avgTurnaround);
+        printf("Avg Waiting Time       : %.2f sec\n", avgWaiting);
+        // Jain indeksi (Σx)² / (n·Σx²), x = burst/turnaround: herkes aynı oranda
+        // ilerlediyse 1, ilerleme tek göreve yığıldıkça 1/n'e iner
+        printf("Fairness (Jain's index): %.4f\n", statProgressSqSum > 0 ?
+            statProgressSum * statProgressSum / (statCompletedTasks * statProgressSqSum) : 1.0);
+    }
+    else {
+        printf("Avg Turnaround Time    : N/A\n");
+        printf("Avg Waiting Time       : N/A\n");
+        printf("Fairness (Jain's index): N/A\n");
+    }
+    printf("--------------------------------------------------\n");
+}
+
+/**
+ * @brief Ana zamanlayıcı (scheduler/controller) görevi.
+ *
+ * Simülasyon bitene kadar xSchedulerStep'i çağırır; ardından özet rapor basar ve
+ * programı sonlandırır. Özet ve çıkış kritik bölgede yapılır: port tick'i SIGALRM ile
+ * doğrudan bu iş parçacığına verir (SA_RESTART yok), stdout bir boruysa çıkıştaki
+ * boşaltma EINTR ile yarıda kalıp özet kaybolabiliyordu.
+ */
+void vSchedulerTask(void* pvParameters) {
+    (void)pvParameters;
+
+    if (!virtualTimeMode) {
+        // İşçiler quantum sonunu bu göreve (controller) bildirir
+        wpInit(&workerPool, WORKER_POOL_PREWARM, xTaskGetCurrentTaskHandle());
+    }
+
+    while (xSchedulerStep()) {
     }
+
+    taskENTER_CRITICAL();
+    printSummary();
+    exit(0);
 }
 
 /**
  * @brief Scheduler başlatılmadan önce görev listesini dosyadan yükler.
  *
- * Burada giriş dosyası sabit olarak "giris.txt" seçilmiş.
+ * inputPath NULL ise varsayılan "giris.txt" kullanılır. Dosya metin ya da ikili iz
+ * biçiminde olabilir (tools/trace_convert); biçim trOpen tarafından otomatik algılanır.
+ */
+void vInitScheduler(const char* inputPath) {
+    const char* path = inputPath != NULL ? inputPath : "giris.txt";
+
+    policy->init(SIM_MAX_CORES);
+    dhInit(&deadlineHeap);
+
+    if (streamMode) {
+        // Akış kipi: dosya yalnızca açılır, gelişler çalışma sırasında çekilir
+        tsInit(&taskStore);
+        trOpen(&streamReader, path);
+        taskCount = 0;
+    }
+    else {
+        loadTasks(path);
+    }
+}
+
+/**
+ * @brief Akış kipini ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetStreaming(int enabled) {
+    streamMode = enabled ? 1 : 0;
+}
+
+/**
+ * @brief Simüle edilen çekirdek sayısını ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetCores(int cores) {
+    if (cores < 1 || cores > SIM_MAX_CORES) {
+        printf("Hata: cekirdek sayisi 1..%d araliginda olmali.\n", SIM_MAX_CORES);
+        exit(1);
+    }
+    coreCount = cores;
+}
+
+/**
+ * @brief Zamanlama politikasını adıyla seçer (bkz. scheduler.h).
+ */
+void vSchedulerSetPolicy(const char* name) {
+    const SchedPolicy* found = policyFind(name);
+    if (found == NULL) {
+        printf("Hata: '%s' bilinmeyen politika.\n", name);
+        policyPrintList();
+        exit(1);
+    }
+    policy = found;
+}
+
+/**
+ * @brief Quantum süresini ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetQuantum(SimTime ticks) {
+    if (ticks <= 0) {
+        printf("Hata: quantum sifirdan buyuk olmali.\n");
+        exit(1);
+    }
+    quantum = ticks;
+}
+
+/**
+ * @brief Zaman aşımı penceresini ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetTimeoutWindow(SimTime ticks) {
+    if (ticks <= 0) {
+        printf("Hata: zaman asimi penceresi sifirdan buyuk olmali.\n");
+        exit(1);
+    }
+    timeoutWindow = ticks;
+}
+
+/**
+ * @brief Tamamlanma kancasını ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetCompletionHook(SchedulerCompletionHook hook) {
+    completionHook = hook;
+}
+
+/**
+ * @brief Sonuç sayaçlarını döndürür (bkz. scheduler.h).
+ */
+void vSchedulerGetStats(SchedulerStats* stats) {
+    stats->policyName = policy->name;
+    stats->cores = coreCount;
+    stats->taskCount = taskCount;
+    stats->simTime = globalTimer;
+    stats->completed = statCompletedTasks;
+    stats->dropped = statDroppedTasks;
+    stats->deadlineTasks = statDeadlineTasks;
+    stats->deadlineMisses = statDeadlineMisses;
+    stats->totalTurnaround = statTotalTurnaround;
+    stats->totalWaiting = statTotalWaiting;
+}
+
+/**
+ * @brief Hafif proses kipini ayarlar (bkz. scheduler.h).
+ */
+void vSchedulerSetLightweight(int enabled) {
+    lightweightMode = enabled ? 1 : 0;
+}
+
+/**
+ * @brief Sanal zaman kipini ayarlar (bkz. scheduler.h).
  */
-void vInitScheduler(void) {
-    loadTasks("giris.txt");
+void vSchedulerSetVirtualTime(int enabled) {
+    virtualTimeMode = enabled ? 1 : 0;
 }
 
 /**
@@ -328,6 +890,6 @@ void vInitScheduler(void) {
  * - Ardından vTaskStartScheduler() çağrısı ile FreeRTOS çalışmaya başlar.
  */
 void vSchedulerStart(void) {
-    xTaskCreate(vSchedulerTask, "Controller", 1000, NULL, configMAX_PRIORITIES - 1, NULL);
+    xTaskCreate(vSchedulerTask, "Controller", CONTROLLER_STACK_DEPTH, NULL, configMAX_PRIORITIES - 1, NULL);
     vTaskStartScheduler();
 }
\ No newline at end of file
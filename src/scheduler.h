@@ -3,35 +3,212 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "task_log.h"
+#include "sim_time.h"
+
+#define TIMEOUT_WINDOW 20   // Bir görevin (task) çalışır durumdayken en fazla bekleyebileceği süre penceresi (sn)
+#define SIM_QUANTUM_MS 1000 // Varsayılan quantum süresi (ms); bkz. vSchedulerSetQuantum
+#define SIM_MAX_CORES  64   // Simüle edilebilecek en fazla çekirdek
 
 /**
- * @brief Simülasyondaki bir işlemi (task) temsil eden veri yapısı.
+ * @brief Simülasyondaki bir görevin yaşam döngüsü durumu.
  *
- * Bu struct hem "giriş dosyasından okunan iş özelliklerini"
- * hem de FreeRTOS tarafındaki çalışma bilgilerini tutar.
+ * Görevin sistemde olup olmadığı artık handle'a bakılarak değil bu alanla anlaşılır;
+ * böylece sanal zaman kipinde FreeRTOS görevi yaratmadan da simülasyon yürütülebilir.
  */
-typedef struct {
-    int id;               // Görev kimliği (genelde yüklenme sırasına göre atanır)
-    int arrivalTime;      // Görevin sisteme gelme zamanı (sn)
-    int priority;         // Görevin anlık öncelik seviyesi (0 en yüksek, 5 en düşük)
-    int burstTime;        // Görevin toplam CPU ihtiyacı (sn)
-    int remainingTime;    // Kalan çalışma süresi (sn)
+typedef enum {
+    TASK_STATE_PENDING = 0, // Henüz gelmedi (arrivalTime > globalTimer)
+    TASK_STATE_READY,       // Sistemde, çalışmayı bekliyor ya da çalışıyor
+    TASK_STATE_FINISHED,    // Başarıyla tamamlandı
+    TASK_STATE_DROPPED      // Zaman aşımı nedeniyle düşürüldü
+} SimTaskState;
+
+/**
+ * @brief Simülasyondaki bir işlemi (task) temsil eden veri yapısı ("sıcak" kısım).
+ *
+ * Yalnızca scheduler'ın her quantum'da okuduğu/yazdığı alanları tutar (48 bayt, hot/cold
+ * ayrımı öncesindeki 56 baytlık kayıttan küçük); hazır kuyrukları ve deadline heap'i bu
+ * kayıtlar üzerinde gezer. Nadiren erişilen isim, FreeRTOS handle'ı, kimlik, geliş
+ * zamanı, toplam süre ve mutlak deadline gibi bilgiler ayrı bir "soğuk" tabloda durur
+ * (bkz. SimulationTaskCold, getTaskCold); bunlara göre sıralayan politikalar anahtarı
+ * gelişte policyKey'e kopyalar, eşitlik bozma ise soğuk kayda iner (taskArrivedBefore).
+ *
+ * Bir simülasyonda tek politika çalıştığından MLFQ'nun kuyruk bağları ile diğer
+ * politikaların küme konumu (policyIndex) aynı baytları paylaşır.
+ */
+typedef struct SimulationTask {
+    union {
+        struct {
+            struct SimulationTask* rqNext; // Hazır kuyruğundaki sonraki görev (intrusive bağ, bkz. ready_queue.h)
+            struct SimulationTask* rqPrev; // Hazır kuyruğundaki önceki görev
+        };
+        int policyIndex; // Politikanın hazır kümesindeki konum (-1: kümede değil, bkz. task_heap.h; MLFQ dışı)
+    };
 
-    int arrivalTimestamp; // Görevin FreeRTOS'ta gerçekten oluşturulduğu anın zamanı (sn)
-    int hasStarted;       // Görev ilk defa CPU gördü mü? (log "başladı" için bayrak)
+    SimTime remainingTime; // Kalan çalışma süresi (tick, bkz. sim_time.h)
+    SimTime deadline;      // Zaman aşımı eşiği: globalTimer bu değere ulaşırsa görev düşer
+    int64_t policyKey;     // Politikaya özgü sıralama anahtarı (örn. CFS vruntime, EDF dueTime), kurulumda 0
 
-    int deadline;         // Zaman aşımı eşiği: globalTimer bu değere ulaşırsa görev düşer
+    int heapIndex;        // Deadline heap'indeki konum (-1: heap'te değil, bkz. deadline_heap.h)
+    int16_t priority;     // Görevin anlık öncelik seviyesi (0 en yüksek, 5 en düşük; yüklemede int16'ya sıkıştırılır)
+    unsigned char state : 4;      // Yaşam döngüsü durumu (SimTaskState değerleri)
+    unsigned char hasStarted : 1; // Görev ilk defa CPU gördü mü? (log "başladı" için bayrak)
+    unsigned char core;   // Görevin hazır kuyruğunda beklediği simüle çekirdek
+} SimulationTask;
 
+/**
+ * @brief Görevin scheduler döngülerinde kullanılmayan ("soğuk") bilgileri.
+ *
+ * Sıcak kayıtla aynı arena yuvasını paylaşır; getTaskCold() ile erişilir.
+ */
+typedef struct {
     char name[16];        // Görev adı (log ve xTaskCreate için)
     TaskHandle_t handle;  // FreeRTOS görev handle'ı (NULL ise oluşturulmamış/silinmiş)
-} SimulationTask;
+    SimTime arrivalTimestamp; // Görevin FreeRTOS'ta gerçekten oluşturulduğu anın zamanı (tick)
+    SimTime burstTime;    // Görevin toplam CPU ihtiyacı (tick; tamamlanmada ve HRRN gelişinde okunur)
+    SimTime dueTime;      // Mutlak deadline (EDF gelişi, kaçırma sayımı); yoksa SIM_TIME_NEVER
+    SimTime arrivalTime;  // Görevin sisteme gelme zamanı (tick)
+    int id;               // Görev kimliği (dosyadaki sıra)
+} SimulationTaskCold;
+
+/**
+ * @brief Tamamlanan her görev için çağrılan kanca (bkz. vSchedulerSetCompletionHook).
+ *
+ * @param turnaround Tamamlanma - geliş (tick)
+ * @param waiting    turnaround - toplam CPU ihtiyacı (tick)
+ */
+typedef void (*SchedulerCompletionHook)(SimTime turnaround, SimTime waiting);
+
+/**
+ * @brief Simülasyonun sonuç sayaçları (özet raporun temel satırları, bkz. vSchedulerGetStats).
+ */
+typedef struct {
+    const char* policyName;  // Zamanlama politikası
+    int cores;               // Simüle edilen çekirdek sayısı
+    int taskCount;           // Yüklenen (akış kipinde o ana kadar okunan) görev sayısı
+    SimTime simTime;         // globalTimer (tick)
+    int completed;           // Tamamlanan görevler
+    int dropped;             // Zaman aşımıyla düşen görevler
+    int deadlineTasks;       // Mutlak deadline'ı olan (sisteme alınmış) görevler
+    int deadlineMisses;      // Deadline'ından sonra tamamlanan görevler
+    SimTime totalTurnaround; // Tamamlananların turnaround toplamı (tick)
+    SimTime totalWaiting;    // Tamamlananların bekleme toplamı (tick)
+} SchedulerStats;
 
 // === Dışarıdan çağrılan fonksiyon prototipleri ===
 
 /**
  * @brief Scheduler başlatılmadan önce gerekli hazırlıkları yapar (örn. görevleri dosyadan yükler).
+ *
+ * @param inputPath Görev listesi dosyası (NULL ise "giris.txt")
+ */
+void vInitScheduler(const char* inputPath);
+
+/**
+ * @brief Sanal zaman kipini açar/kapatır (vSchedulerStart'tan önce çağrılmalı).
+ *
+ * Sanal zaman kipinde quantum başına gerçek vTaskDelay beklenmez; globalTimer bir sonraki
+ * olayın (geliş, quantum sonu/tamamlanma, zaman aşımı) zamanına doğrudan atlar ve simüle
+ * edilen prosesler için FreeRTOS görevi yaratılmaz. Log ve özet çıktısı gerçek zaman kipiyle aynıdır.
+ *
+ * @param enabled 0 ise gerçek zaman (varsayılan), aksi halde sanal zaman
+ */
+void vSchedulerSetVirtualTime(int enabled);
+
+/**
+ * @brief Akış (streaming) kipini açar/kapatır (vInitScheduler'dan önce çağrılmalı).
+ *
+ * Akış kipinde giriş dosyası baştan tümüyle yüklenmez; gelişler globalTimer onlara
+ * yaklaştıkça sınırlı bir ön okuma tamponu üzerinden dosyadan çekilir. Biten ve zaman
+ * aşımına uğrayan görevlerin yuvaları yeniden kullanılır; bellek, dosya uzunluğuyla
+ * değil aynı anda sistemde olan görev sayısıyla büyür. Giriş dosyası geliş zamanına göre
+ * sıralı olmalıdır.
+ *
+ * @param enabled 0 ise tüm dosya önceden yüklenir (varsayılan), aksi halde akış kipi
+ */
+void vSchedulerSetStreaming(int enabled);
+
+/**
+ * @brief Hafif proses kipini açar/kapatır (vSchedulerStart'tan önce çağrılmalı).
+ *
+ * Bu kipte simüle edilen prosesler yalnızca veri kaydıdır (handle NULL kalır) ve tamamen
+ * controller tarafından yürütülür; yaşayan proses başına TCB, pthread ya da yığın ayrılmaz.
+ * Gerçek zaman kipinde iş yükünü yürütecek FreeRTOS işçisi yalnızca o an çalışan prosese,
+ * quantum süresince havuzdan bağlanır. Böylece milyonlarca yaşayan proses yalnızca
+ * kayıtlarının belleğiyle tutulabilir: görev başına sizeof(SimulationTask) +
+ * sizeof(SimulationTaskCold), x86-64'te 48 + 64 = 112 bayt. Sanal zaman kipi zaten bu
+ * şekilde çalışır.
+ *
+ * @param enabled 0 ise her yaşayan prosese bir işçi bağlanır (varsayılan), aksi halde hafif kip
+ */
+void vSchedulerSetLightweight(int enabled);
+
+/**
+ * @brief Simüle edilen çekirdek sayısını ayarlar (vSchedulerStart'tan önce çağrılmalı).
+ *
+ * Her çekirdeğin kendi seviye kuyrukları vardır; gelen görev en az yüklü çekirdeğe
+ * yerleşir, kuyruğu boş kalan çekirdek en yüklü çekirdekten çalar (work stealing).
+ * Tüm çekirdekler aynı quantum sınırlarında ilerler. 1'den büyükse özet; çekirdek başına
+ * kullanım, göç (migration) sayısı ve yük dengesizliği istatistiklerini de içerir.
+ *
+ * @param cores 1..SIM_MAX_CORES (varsayılan 1: tek CPU, eski davranış)
+ */
+void vSchedulerSetCores(int cores);
+
+/**
+ * @brief Quantum süresini ayarlar (vSchedulerStart'tan önce çağrılmalı).
+ *
+ * Quantum kesirli olabilir (örn. 0.25 sn); görev kalan süresinden kısa bir dilim
+ * kalmışsa yalnızca o kadar çalışır ve saat o kadar ilerler. Gerçek zaman kipinde
+ * işçiler quantum başına bu süre kadar (en az bir FreeRTOS tick'i) bekler.
+ *
+ * @param quantum Tick cinsinden süre (> 0, varsayılan 1 sn)
+ */
+void vSchedulerSetQuantum(SimTime quantum);
+
+/**
+ * @brief Zamanlama politikasını adıyla seçer (vInitScheduler'dan önce çağrılmalı).
+ *
+ * Bilinmeyen adda hata ve politika listesi basılıp program sonlandırılır
+ * (bkz. policy.h; varsayılan "mlfq").
+ *
+ * @param name Politika adı (örn. "mlfq")
+ */
+void vSchedulerSetPolicy(const char* name);
+
+/**
+ * @brief Zaman aşımı penceresini ayarlar (ilk xSchedulerStep'ten önce çağrılmalı).
+ *
+ * Görev gelişinden ve her quantum sonundan itibaren bu süre içinde CPU görmezse düşer.
+ * Hedef görev sisteme alınırken atandığından vInitScheduler'dan sonra da değiştirilebilir.
+ *
+ * @param ticks Tick cinsinden süre (> 0, varsayılan TIMEOUT_WINDOW sn)
  */
-void vInitScheduler(void);
+void vSchedulerSetTimeoutWindow(SimTime ticks);
+
+/**
+ * @brief Tamamlanan her görevde çağrılacak kancayı ayarlar (NULL: yok, varsayılan).
+ *
+ * Parametre taraması turnaround/bekleme yüzdeliklerini bununla toplar.
+ */
+void vSchedulerSetCompletionHook(SchedulerCompletionHook hook);
+
+/**
+ * @brief Controller'ın tek adımını yürütür: gelişler, çekirdek başına seçim (ve çalma),
+ *        bir quantum çalıştırma ya da boştaysa bir sonraki olaya atlama.
+ *
+ * vSchedulerTask bu adımı simülasyon bitene kadar tekrarlar. FreeRTOS'a yalnızca
+ * gerçek zaman kipinde dokunur; sanal zaman kipinde FreeRTOS başlatılmadan, doğrudan
+ * vInitScheduler'dan sonra çağrılabilir (parametre taraması böyle çalışır).
+ *
+ * @return Simülasyon bittiyse 0, aksi halde 1
+ */
+int xSchedulerStep(void);
+
+/**
+ * @brief O ana kadarki sonuç sayaçlarını stats'a yazar.
+ */
+void vSchedulerGetStats(SchedulerStats* stats);
 
 /**
  * @brief Scheduler/controller görevini oluşturur ve FreeRTOS scheduler'ı başlatır.
@@ -39,17 +216,33 @@ void vInitScheduler(void);
 void vSchedulerStart(void);
 
 /**
- * @brief Simülasyonda oluşturulan görevlerin kullandığı genel (boş) görev fonksiyonu.
- * Scheduler resume/suspend ile yürütmeyi simüle eder.
+ * @brief Görevin soğuk tablodaki (isim, handle, ...) kaydını döndürür.
+ *
+ * Sıcak kaydın adresinden hesaplanır (bkz. task_store.h); kayıtta yuva indeksi tutulmaz.
+ */
+SimulationTaskCold* getTaskCold(const SimulationTask* task);
+
+/**
+ * @brief Politikaların ortak eşitlik bozucusu: önce gelen, eşitse dosyada önce olan (id).
+ *
+ * @return a, b'den önce seçilmeliyse 1
+ */
+int taskArrivedBefore(const SimulationTask* a, const SimulationTask* b);
+
+/**
+ * @brief Simülasyonda oluşturulan işçi görevlerinin kullandığı genel (boş) görev fonksiyonu.
+ *
+ * Scheduler her quantum'u doğrudan görev bildirimiyle başlatır; işçi quantum sonunu
+ * controller'a (pvParameters) bildirimle onaylar.
  */
 void vTaskGenericFunction(void* pvParameters);
 
 /**
- * @brief Bir görevin durumunu konsola (renkli/formatlı) loglar.
+ * @brief Bir görevin durumunu loglar (satır, log yazıcısı tarafından renkli/formatlı basılır).
  *
- * @param task   Loglanacak görevin adresi
- * @param status Durum metni (örn: "başladı", "yürütülüyor", "askıda", "sonlandı", "zamanaşımı")
+ * @param task  Loglanacak görevin adresi
+ * @param event Durum (başladı, yürütülüyor, askıda, sonlandı, zamanaşımı)
  */
-void printTaskLog(SimulationTask* task, const char* status);
+void printTaskLog(SimulationTask* task, TaskLogEvent event);
 
 #endif
\ No newline at end of file
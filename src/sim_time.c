@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include "sim_time.h"
+
+#define SIM_TIME_MAX_SECONDS 922337203685LL // Tick cinsinden int64'e sığan en büyük tam saniye
+
+/**
+ * @brief Süreyi saniye olarak yazar (bkz. sim_time.h).
+ */
+size_t simFormatSeconds(char* out, size_t capacity, SimTime t) {
+    const char* sign = t < 0 ? "-" : "";
+    uint64_t magnitude = t < 0 ? (uint64_t)0 - (uint64_t)t : (uint64_t)t;
+    uint64_t whole = magnitude / SIM_TICKS_PER_SEC;
+    uint64_t frac = magnitude % SIM_TICKS_PER_SEC;
+    int n;
+
+    if (frac == 0) {
+        n = snprintf(out, capacity, "%s%llu", sign, (unsigned long long)whole);
+    }
+    else {
+        int digits = SIM_TIME_DIGITS;
+        while (frac % 10 == 0) {
+            frac /= 10;
+            digits--;
+        }
+        n = snprintf(out, capacity, "%s%llu.%0*llu", sign, (unsigned long long)whole,
+            digits, (unsigned long long)frac);
+    }
+
+    if (n < 0) {
+        return 0;
+    }
+    return (size_t)n < capacity ? (size_t)n : capacity - 1;
+}
+
+/**
+ * @brief Saniye değerini tick'e çevirir (bkz. sim_time.h).
+ */
+const char* simParseSeconds(const char* p, const char* end, SimTime* out) {
+    int negative = 0;
+    int64_t whole = 0;
+    int64_t frac = 0;
+    int digits = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p >= end || (unsigned)(*p - '0') > 9) {
+        return NULL;
+    }
+    while (p < end && (unsigned)(*p - '0') <= 9) {
+        whole = whole * 10 + (*p - '0');
+        if (whole > SIM_TIME_MAX_SECONDS) {
+            return NULL;
+        }
+        p++;
+    }
+
+    if (p < end && *p == '.') {
+        p++;
+        while (p < end && (unsigned)(*p - '0') <= 9) {
+            if (++digits > SIM_TIME_DIGITS) {
+                return NULL;
+            }
+            frac = frac * 10 + (*p - '0');
+            p++;
+        }
+        for (int d = digits; d < SIM_TIME_DIGITS; d++) {
+            frac *= 10;
+        }
+    }
+
+    SimTime value = whole * SIM_TICKS_PER_SEC + frac;
+    *out = negative ? -value : value;
+    return p;
+}
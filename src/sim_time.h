@@ -0,0 +1,50 @@
+#ifndef SIM_TIME_H
+#define SIM_TIME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SIM_TICKS_PER_SEC 10000 // Simülasyon zamanının çözünürlüğü: 1 tick = 100 us (log'daki 4 ondalık)
+#define SIM_TIME_DIGITS   4     // Bir saniyenin ondalık basamak sayısı (10^4 = SIM_TICKS_PER_SEC)
+#define SIM_TIME_NEVER    INT64_MAX // Hiç gelmeyecek zaman (örn. deadline'ı olmayan görev)
+
+/**
+ * @brief Simülasyon zamanı ve süreleri: 64 bit, sabit çözünürlüklü tick sayısı.
+ *
+ * Geliş, çalışma süresi, kalan süre, deadline ve globalTimer aynı birimdedir; kesirli
+ * saniyeler (0.25 sn gibi) kayan nokta hatası olmadan tam sayı olarak tutulur.
+ */
+typedef int64_t SimTime;
+
+/**
+ * @brief Tam saniyeyi tick'e çevirir.
+ */
+static inline SimTime simSeconds(int64_t seconds) {
+    return (SimTime)seconds * SIM_TICKS_PER_SEC;
+}
+
+/**
+ * @brief Süreyi saniye olarak (kayan nokta) verir; yalnızca raporlama için.
+ */
+static inline double simToSeconds(SimTime t) {
+    return (double)t / SIM_TICKS_PER_SEC;
+}
+
+/**
+ * @brief Süreyi sondaki sıfırları atılmış saniye olarak yazar ("44", "1.5", "0.25").
+ *
+ * @return Yazılan bayt sayısı (sonlandırıcı hariç)
+ */
+size_t simFormatSeconds(char* out, size_t capacity, SimTime t);
+
+/**
+ * @brief "12", "0.25", "-3.5" biçimindeki saniye değerini tick'e çevirir.
+ *
+ * En fazla SIM_TIME_DIGITS ondalık basamak kabul edilir.
+ *
+ * @return Başarılıysa sayıdan sonraki konum; sayı yoksa, taşarsa ya da çözünürlükten
+ *         ince ise NULL
+ */
+const char* simParseSeconds(const char* p, const char* end, SimTime* out);
+
+#endif
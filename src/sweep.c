@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "scheduler.h"
+#include "policy.h"
+#include "ready_queue.h"
+#include "sweep.h"
+
+/**
+ * @brief Bir yapılandırmanın sonucu (tablodaki bir satır).
+ */
+typedef struct {
+    SweepConfig config;
+    int taskCount;        // Simüle edilen görev sayısı
+    SimTime simTime;      // Toplam simülasyon süresi (tick)
+    int completed;
+    int dropped;
+    int missed;           // Mutlak deadline'ı geçerek biten görevler
+    int deadlineTasks;    // Mutlak deadline'ı olan görevler
+    double avgTurnaround; // sn
+    double avgWaiting;    // sn
+    SimTime turnaround[3]; // p50, p95, p99 (tick)
+    SimTime waiting[3];    // p50, p95, p99 (tick)
+} SweepResult;
+
+// === Yapılandırmalar ve çalışan çocuk süreçler (ebeveynde) ===
+static SweepConfig* configs = NULL;
+static SweepResult* results = NULL;
+static pid_t* pids = NULL;    // Yapılandırmayı çalıştıran süreç
+static int* readFds = NULL;   // Sonucun okunacağı borunun ucu
+static int configCount = 0;
+
+// === Tamamlanan görevlerin süreleri (çocuk süreçte, yüzdelikler için) ===
+static SimTime* turnarounds = NULL;
+static SimTime* waits = NULL;
+static int sampleCount = 0;
+static int sampleCapacity = 0;
+
+static const double PERCENTILES[3] = { 0.50, 0.95, 0.99 };
+
+/**
+ * @brief Virgülle ayrılmış listeyi okur (bkz. sweep.h).
+ */
+int sweepParseList(const char* text, int* values) {
+    int count = 0;
+    const char* p = text;
+
+    while (*p != '\0') {
+        char* end;
+        long v = strtol(p, &end, 10);
+        if (end == p || v <= 0 || count == SWEEP_MAX_VALUES || (*end != ',' && *end != '\0')) {
+            printf("Hata: '%s' pozitif tamsayi listesi degil (or. 10,20,30).\n", text);
+            exit(1);
+        }
+        values[count++] = (int)v;
+        p = *end == ',' ? end + 1 : end;
+    }
+    if (count == 0) {
+        printf("Hata: '%s' bos liste.\n", text);
+        exit(1);
+    }
+    return count;
+}
+
+/**
+ * @brief Virgülle ayrılmış saniye listesini okur (bkz. sweep.h).
+ */
+int sweepParseTimeList(const char* text, SimTime* values) {
+    int count = 0;
+    const char* p = text;
+    const char* end = text + strlen(text);
+
+    while (p < end) {
+        SimTime v;
+        const char* next = simParseSeconds(p, end, &v);
+        if (next == NULL || v <= 0 || count == SWEEP_MAX_VALUES || (*next != ',' && *next != '\0')) {
+            printf("Hata: '%s' pozitif sure listesi degil (or. 0.5,1,2).\n", text);
+            exit(1);
+        }
+        values[count++] = v;
+        p = *next == ',' ? next + 1 : next;
+    }
+    if (count == 0) {
+        printf("Hata: '%s' bos liste.\n", text);
+        exit(1);
+    }
+    return count;
+}
+
+static int compareTime(const void* a, const void* b) {
+    SimTime x = *(const SimTime*)a;
+    SimTime y = *(const SimTime*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sıralı dizide en yakın sıra (nearest-rank) yüzdeliği.
+ */
+static SimTime percentile(const SimTime* sorted, int n, double q) {
+    if (n == 0) {
+        return 0;
+    }
+    int rank = (int)(q * n + 0.999999);
+    if (rank < 1) {
+        rank = 1;
+    }
+    return sorted[(rank < n ? rank : n) - 1];
+}
+
+/**
+ * @brief Tamamlanma kancası: çocuk süreçte görevin sürelerini yüzdelik dizilerine ekler.
+ */
+static void recordCompletion(SimTime turnaround, SimTime waiting) {
+    if (sampleCount == sampleCapacity) {
+        sampleCapacity = sampleCapacity > 0 ? sampleCapacity * 2 : 1024;
+        turnarounds = realloc(turnarounds, (size_t)sampleCapacity * sizeof(SimTime));
+        waits = realloc(waits, (size_t)sampleCapacity * sizeof(SimTime));
+        if (turnarounds == NULL || waits == NULL) {
+            printf("Hata: Bellek ayrilamadi.\n");
+            exit(1);
+        }
+    }
+    turnarounds[sampleCount] = turnaround;
+    waits[sampleCount] = waiting;
+    sampleCount++;
+}
+
+/**
+ * @brief Çocuk süreç: yüklenmiş simülasyonu yapılandırmayla sonuna kadar çalıştırır ve
+ *        sonucu boruya yazar.
+ *
+ * Adımlar ana simülasyonun controller adımıdır (xSchedulerStep); politika durumu modül
+ * içinde statik olduğundan her yapılandırma kendi sürecinde (fork) yürür.
+ */
+static void runConfig(const SweepConfig* config, int fd) {
+    SweepResult result;
+    SchedulerStats stats;
+
+    logDisable();
+    vSchedulerSetTimeoutWindow(config->timeoutWindow);
+    vSchedulerSetQuantum(config->quantum);
+    mlfqSetLevels(config->levels);
+    vSchedulerSetCompletionHook(recordCompletion);
+
+    while (xSchedulerStep()) {
+    }
+
+    vSchedulerGetStats(&stats);
+    memset(&result, 0, sizeof(result));
+    result.config = *config;
+    result.taskCount = stats.taskCount;
+    result.simTime = stats.simTime;
+    result.completed = stats.completed;
+    result.dropped = stats.dropped;
+    result.missed = stats.deadlineMisses;
+    result.deadlineTasks = stats.deadlineTasks;
+    if (stats.completed > 0) {
+        result.avgTurnaround = simToSeconds(stats.totalTurnaround) / stats.completed;
+        result.avgWaiting = simToSeconds(stats.totalWaiting) / stats.completed;
+
+        qsort(turnarounds, (size_t)sampleCount, sizeof(SimTime), compareTime);
+        qsort(waits, (size_t)sampleCount, sizeof(SimTime), compareTime);
+        for (int i = 0; i < 3; i++) {
+            result.turnaround[i] = percentile(turnarounds, sampleCount, PERCENTILES[i]);
+            result.waiting[i] = percentile(waits, sampleCount, PERCENTILES[i]);
+        }
+    }
+
+    // Sonuç PIPE_BUF'tan küçük olduğundan tek write ile bölünmeden yazılır
+    _exit(write(fd, &result, sizeof(result)) == (ssize_t)sizeof(result) ? 0 : 1);
+}
+
+/**
+ * @brief i. yapılandırma için çocuk süreç başlatır.
+ */
+static void startConfig(int i) {
+    int fds[2];
+
+    if (pipe(fds) != 0) {
+        printf("Hata: boru olusturulamadi.\n");
+        exit(1);
+    }
+    fflush(stdout); // Tampondaki çıktı çocukta ikinci kez yazılmasın
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        printf("Hata: surec baslatilamadi.\n");
+        exit(1);
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        runConfig(&configs[i], fds[1]);
+    }
+    close(fds[1]);
+    pids[i] = pid;
+    readFds[i] = fds[0];
+}
+
+/**
+ * @brief Biten bir çocuğu bekler ve sonucunu okur.
+ */
+static void finishConfig(void) {
+    int status;
+    pid_t pid = wait(&status);
+    int i = 0;
+
+    while (i < configCount && pids[i] != pid) {
+        i++;
+    }
+    if (pid < 0 || i == configCount) {
+        printf("Hata: tarama sureci beklenemedi.\n");
+        exit(1);
+    }
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 ||
+        read(readFds[i], &results[i], sizeof(SweepResult)) != (ssize_t)sizeof(SweepResult)) {
+        printf("Hata: yapilandirma %d calistirilamadi.\n", i + 1);
+        exit(1);
+    }
+    close(readFds[i]);
+}
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Izgarayı paralel çalıştırır ve sonuç tablosunu basar (bkz. sweep.h).
+ */
+void runSweep(const char* inputPath, SweepGrid* grid) {
+    if (grid->timeoutWindowCount == 0) {
+        grid->timeoutWindows[grid->timeoutWindowCount++] = simSeconds(TIMEOUT_WINDOW);
+    }
+    if (grid->quantumCount == 0) {
+        grid->quanta[grid->quantumCount++] = (SimTime)SIM_QUANTUM_MS * SIM_TICKS_PER_SEC / 1000;
+    }
+    if (grid->levelCount == 0) {
+        grid->levels[grid->levelCount++] = READY_LEVELS;
+    }
+    for (int i = 0; i < grid->levelCount; i++) {
+        if (grid->levels[i] < 2 || grid->levels[i] > READY_LEVELS) {
+            printf("Hata: seviye sayisi 2..%d araliginda olmali.\n", READY_LEVELS);
+            exit(1);
+        }
+    }
+
+    // Dosya bir kez yüklenir; çocuk süreçler yüklenmiş durumu (copy-on-write) devralır
+    double t0 = nowSeconds();
+    vSchedulerSetVirtualTime(1);
+    vInitScheduler(inputPath);
+    double t1 = nowSeconds();
+
+    configCount = grid->timeoutWindowCount * grid->quantumCount * grid->levelCount;
+    configs = malloc((size_t)configCount * sizeof(SweepConfig));
+    results = malloc((size_t)configCount * sizeof(SweepResult));
+    pids = malloc((size_t)configCount * sizeof(pid_t));
+    readFds = malloc((size_t)configCount * sizeof(int));
+    if (configs == NULL || results == NULL || pids == NULL || readFds == NULL) {
+        printf("Hata: Bellek ayrilamadi.\n");
+        exit(1);
+    }
+
+    int k = 0;
+    for (int a = 0; a < grid->timeoutWindowCount; a++) {
+        for (int b = 0; b < grid->quantumCount; b++) {
+            for (int c = 0; c < grid->levelCount; c++) {
+                configs[k].timeoutWindow = grid->timeoutWindows[a];
+                configs[k].quantum = grid->quanta[b];
+                configs[k].levels = grid->levels[c];
+                pids[k] = -1;
+                k++;
+            }
+        }
+    }
+
+    // Aynı anda makinedeki çekirdek sayısı kadar süreç (yapılandırma sayısını aşmadan)
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int procCount = cpus > 0 ? (int)cpus : 1;
+    if (procCount > configCount) {
+        procCount = configCount;
+    }
+
+    int started = 0;
+    for (; started < procCount; started++) {
+        startConfig(started);
+    }
+    for (int done = 0; done < configCount; done++) {
+        finishConfig();
+        if (started < configCount) {
+            startConfig(started++);
+        }
+    }
+    double t2 = nowSeconds();
+
+    SchedulerStats stats;
+    vSchedulerGetStats(&stats);
+
+    // "missed" sütunu yalnızca izde deadline verilmişse basılır; eski izlerin çıktısı değişmez
+    int deadlines = results[0].deadlineTasks > 0;
+    printf("%7s %7s %6s %9s %7s ", "timeout", "quantum", "levels", "completed", "dropped");
+    if (deadlines) {
+        printf("%6s ", "missed");
+    }
+    printf("%8s %5s %5s %5s %8s %5s %5s %5s %7s\n",
+        "avgTurn", "p50", "p95", "p99", "avgWait", "p50", "p95", "p99", "simTime");
+    for (int i = 0; i < configCount; i++) {
+        const SweepResult* r = &results[i];
+        // Süreler saniye olarak, sondaki sıfırlar atılmış yazılır (tam saniyelerde tamsayı)
+        char cell[8][32];
+        simFormatSeconds(cell[0], sizeof(cell[0]), r->config.timeoutWindow);
+        simFormatSeconds(cell[1], sizeof(cell[1]), r->config.quantum);
+        for (int q = 0; q < 3; q++) {
+            simFormatSeconds(cell[2 + q], sizeof(cell[2 + q]), r->turnaround[q]);
+            simFormatSeconds(cell[5 + q], sizeof(cell[5 + q]), r->waiting[q]);
+        }
+        char simTime[32];
+        simFormatSeconds(simTime, sizeof(simTime), r->simTime);
+
+        printf("%7s %7s %6d %9d %7d ", cell[0], cell[1], r->config.levels, r->completed, r->dropped);
+        if (deadlines) {
+            printf("%6d ", r->missed);
+        }
+        printf("%8.2f %5s %5s %5s %8.2f %5s %5s %5s %7s\n",
+            r->avgTurnaround, cell[2], cell[3], cell[4],
+            r->avgWaiting, cell[5], cell[6], cell[7],
+            simTime);
+    }
+    printf("\n%d gorev, %d yapilandirma (%s, %d cekirdek), %d surec: yukleme %.2f sn, simulasyon %.2f sn\n",
+        results[0].taskCount, configCount, stats.policyName, stats.cores, procCount, t1 - t0, t2 - t1);
+
+    free(configs);
+    free(results);
+    free(pids);
+    free(readFds);
+}
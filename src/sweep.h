@@ -0,0 +1,67 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include "sim_time.h"
+
+#define SWEEP_MAX_VALUES 32 // Bir parametre için verilebilecek en fazla değer
+
+/**
+ * @brief Tek bir simülasyon yapılandırması (ızgaradaki bir nokta).
+ */
+typedef struct {
+    SimTime timeoutWindow; // Zaman aşımı penceresi (tick), ana simülasyonda TIMEOUT_WINDOW sn
+    SimTime quantum;       // Quantum uzunluğu (tick), ana simülasyonda 1 sn
+    int levels;            // MLFQ seviye sayısı (2..READY_LEVELS, bkz. mlfqSetLevels), ana simülasyonda READY_LEVELS
+} SweepConfig;
+
+/**
+ * @brief Parametre ızgarası: her listenin kartezyen çarpımı çalıştırılır.
+ *
+ * Boş bırakılan liste (count == 0) varsayılan tek değerle doldurulur.
+ */
+typedef struct {
+    SimTime timeoutWindows[SWEEP_MAX_VALUES];
+    int timeoutWindowCount;
+    SimTime quanta[SWEEP_MAX_VALUES];
+    int quantumCount;
+    int levels[SWEEP_MAX_VALUES];
+    int levelCount;
+} SweepGrid;
+
+/**
+ * @brief Virgülle ayrılmış pozitif tamsayı listesini ("10,20,30") okur.
+ *
+ * Hatalı listede hata basılır ve program sonlandırılır.
+ *
+ * @return Okunan değer sayısı
+ */
+int sweepParseList(const char* text, int* values);
+
+/**
+ * @brief Virgülle ayrılmış pozitif saniye listesini ("0.5,1,2") tick olarak okur.
+ *
+ * Hatalı listede hata basılır ve program sonlandırılır.
+ *
+ * @return Okunan değer sayısı
+ */
+int sweepParseTimeList(const char* text, SimTime* values);
+
+/**
+ * @brief Izgaradaki tüm yapılandırmaları sanal zamanda paralel çalıştırır ve sonuçları basar.
+ *
+ * Giriş dosyası vInitScheduler ile bir kez yüklenir. Her yapılandırma ayrı bir çocuk
+ * süreçte (fork) yüklenmiş durumdan başlar: politikaların durumu modül içinde statik
+ * olduğundan çalıştırmalar süreçlerle ayrılır, görev arenası copy-on-write paylaşılır.
+ * Aynı anda makinedeki çekirdek sayısı kadar süreç çalışır; sonuç boruyla ebeveyne döner.
+ * FreeRTOS başlatılmaz ve log basılmaz; yapılandırma başına bir satır yazılır (tamamlanan,
+ * düşen, izde deadline varsa kaçırılan, ortalama ve p50/p95/p99 turnaround/bekleme).
+ *
+ * Çalıştırmalar ana simülasyonun controller adımını (xSchedulerStep) kullanır; seçilmiş
+ * politika, çekirdek sayısı ve yükseltme gibi ayarlar tüm yapılandırmalara uygulanır.
+ * Zaman aşımı penceresi vSchedulerSetTimeoutWindow, quantum vSchedulerSetQuantum,
+ * seviye sayısı mlfqSetLevels ile verilir. Bu yüzden bir yapılandırmanın satırı, aynı
+ * ayarlarla -v ile çalıştırılan simülasyonun özetiyle aynıdır.
+ */
+void runSweep(const char* inputPath, SweepGrid* grid);
+
+#endif
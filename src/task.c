@@ -1,78 +1,65 @@
 #include "scheduler.h"
 #include <stdio.h>
 #include <string.h>
-
-// ANSI renk kodları (terminal çıktısını renklendirmek için)
-#define COLOR_RESET   "\033[0m"
-#define COLOR_BLUE    "\033[1;34m"
-#define COLOR_RED     "\033[1;31m"
-#define COLOR_GREEN   "\033[1;32m"
-#define COLOR_YELLOW  "\033[1;33m"
-#define COLOR_MAGENTA "\033[1;35m"
-#define COLOR_CYAN    "\033[1;36m"
-#define COLOR_BEIGE   "\033[38;5;230m"
-
-// Görev ID'sine göre kullanılacak renk dizisi (id % 6 ile seçiliyor)
-const char* TASK_COLORS[] = {
-    COLOR_BLUE, COLOR_RED, COLOR_GREEN,
-    COLOR_YELLOW, COLOR_MAGENTA, COLOR_CYAN
-};
+#include "task_log.h"
 
 // Scheduler tarafında tutulan global simülasyon zamanını burada kullanmak için extern
-extern int globalTimer;
+extern SimTime globalTimer;
 
 /**
- * @brief Bir görevin (task) durumunu, simülasyon zamanıyla birlikte renklendirerek konsola yazdırır.
+ * @brief Bir görevin (task) durumunu, simülasyon zamanıyla birlikte log halkasına yazar.
  *
  * Amaç:
- * - Her görevi farklı renkte göstererek logları okunabilir hale getirmek.
  * - Zaman, isim, durum, id, öncelik ve kalan süre bilgilerini tek satırda raporlamak.
+ * - Controller görevini konsol yazımıyla bekletmemek: burada yalnızca sabit boyutlu bir
+ *   kayıt doldurulur; renk seçimi, biçimlendirme ve stdout'a toplu yazım yazıcı iş
+ *   parçacığında yapılır (bkz. task_log.h).
  *
- * Renk seçimi:
- * - colorIndex = task->id % 6 ile TASK_COLORS dizisinden seçilir.
- *
- * Çıktı formatı:
- * - "<zaman>.0000 sn <isim> <durum> (id:xxxx öncelik:x kalan süre:x sn)"
- *
- * Not:
- * - ffush(stdout) ile çıktının anında görünmesi sağlanır (buffer gecikmesini engeller).
+ * Çıktı formatı (formatTaskLog):
+ * - "<zaman> sn <isim> <durum> (id:xxxx öncelik:x kalan süre:x sn)"
  *
- * @param task   Log basılacak görevin adresi
- * @param status Görevin durumu (örn: "başladı", "yürütülüyor", "askıda", "sonlandı", "zamanaşımı")
+ * @param task  Log basılacak görevin adresi
+ * @param event Görevin durumu (başladı, yürütülüyor, askıda, sonlandı, zamanaşımı)
  */
-void printTaskLog(SimulationTask* task, const char* status) {
-    int colorIndex = task->id % 6;
-    const char* color = TASK_COLORS[colorIndex];
+void printTaskLog(SimulationTask* task, TaskLogEvent event) {
+    TaskLogRecord record;
 
-    // \t kaldırıldı (bazı terminallerde satır kayması/kesilme sorununu azaltmak için)
-    // Hizalama: %-6s (isim) ve %-13s (durum) alanları sabit genişlikte yazılır
-    printf("%s%d.0000 sn %-6s %-13s (id:%04d  öncelik:%d  kalan süre:%d sn)%s\n",
-        color,
-        globalTimer,
-        task->name,
-        status,
-        task->id,
-        task->priority,
-        task->remainingTime,
-        COLOR_RESET);
-    fflush(stdout);
+    // Log kapalıysa (parametre taraması) kayıt hiç doldurulmaz
+    if (!logEnabled()) {
+        return;
+    }
+
+    record.time = globalTimer;
+    record.id = getTaskCold(task)->id;
+    record.priority = task->priority;
+    record.remainingTime = task->remainingTime;
+    record.event = (unsigned char)event;
+    memcpy(record.name, getTaskCold(task)->name, sizeof(record.name));
+
+    logPush(&record);
 }
 
 /**
- * @brief Simülasyonda oluşturulan FreeRTOS görevleri için "placeholder" görev fonksiyonu.
+ * @brief Simülasyonda proseslere bağlanan FreeRTOS işçi görevlerinin fonksiyonu.
  *
  * Bu fonksiyon:
- * - Gerçek iş yapmaz.
- * - Sonsuz döngüde kısa aralıklarla (100 ms) delay atarak görev "yaşıyormuş" gibi davranır.
+ * - Gerçek iş yapmaz; controller'dan doğrudan görev bildirimi (xTaskNotify) bekler.
+ * - Bildirimin değeri bu quantum'da çalışılacak dilimdir (FreeRTOS tick); işçi o kadar
+ *   "çalışır" (delay) ve quantum sonunu controller'a yine bildirimle onaylar; ardından
+ *   bir sonraki bildirimi bekler.
  *
  * Not:
- * - Asıl çalışma/CPU tüketimi, scheduler'ın resume/suspend ve remainingTime mantığıyla simüle edilir.
+ * - Bildirim beklerken görev bloklu durur; suspend/resume gerekmez.
+ * - Asıl CPU tüketimi scheduler'ın remainingTime mantığıyla simüle edilir.
  *
- * @param pvParameters Göreve aktarılabilecek parametre (burada kullanılmıyor)
+ * @param pvParameters Quantum sonunda bildirilecek controller görevinin handle'ı
  */
 void vTaskGenericFunction(void* pvParameters) {
-    (void)pvParameters;
-    while (1) {
-        vTaskDelay(pdMS_TO_TICKS(100));
+    TaskHandle_t controller = (TaskHandle_t)pvParameters;
+
+    for (;;) {
+        TickType_t slice = (TickType_t)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(slice);
+        xTaskNotifyGive(controller);
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "task_heap.h"
+
+/**
+ * @brief i konumuna görevi yazar ve görevin policyIndex alanını günceller.
+ */
+static void thPlace(TaskHeap* heap, int i, SimulationTask* task) {
+    heap->items[i] = task;
+    task->policyIndex = i;
+}
+
+/**
+ * @brief i konumundaki görevi köke doğru kaydırır.
+ */
+static void thSiftUp(TaskHeap* heap, int i) {
+    SimulationTask* task = heap->items[i];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!heap->less(task, heap->items[parent])) {
+            break;
+        }
+        thPlace(heap, i, heap->items[parent]);
+        i = parent;
+    }
+    thPlace(heap, i, task);
+}
+
+/**
+ * @brief i konumundaki görevi yapraklara doğru kaydırır.
+ */
+static void thSiftDown(TaskHeap* heap, int i) {
+    SimulationTask* task = heap->items[i];
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= heap->size) {
+            break;
+        }
+        if (child + 1 < heap->size && heap->less(heap->items[child + 1], heap->items[child])) {
+            child++;
+        }
+        if (!heap->less(heap->items[child], task)) {
+            break;
+        }
+        thPlace(heap, i, heap->items[child]);
+        i = child;
+    }
+    thPlace(heap, i, task);
+}
+
+/**
+ * @brief Boş bir heap hazırlar.
+ */
+void thInit(TaskHeap* heap, TaskHeapLess less) {
+    heap->items = NULL;
+    heap->size = 0;
+    heap->capacity = 0;
+    heap->less = less;
+}
+
+/**
+ * @brief Görevi heap'e ekler; dizi dolarsa kapasite iki katına çıkarılır.
+ */
+void thPush(TaskHeap* heap, SimulationTask* task) {
+    if (heap->size == heap->capacity) {
+        int newCapacity = heap->capacity ? heap->capacity * 2 : 64;
+        SimulationTask** items = realloc(heap->items, (size_t)newCapacity * sizeof(*items));
+        if (!items) {
+            printf("Hata: politika heap'i icin bellek ayrilamadi.\n");
+            exit(1);
+        }
+        heap->items = items;
+        heap->capacity = newCapacity;
+    }
+
+    thPlace(heap, heap->size, task);
+    heap->size++;
+    thSiftUp(heap, heap->size - 1);
+}
+
+/**
+ * @brief Görevi heap'ten çıkarır; yerine son eleman konup uygun yöne kaydırılır.
+ */
+void thRemove(TaskHeap* heap, SimulationTask* task) {
+    int i = task->policyIndex;
+    if (i < 0) {
+        return;
+    }
+
+    task->policyIndex = -1;
+    heap->size--;
+
+    if (i == heap->size) {
+        return;
+    }
+
+    thPlace(heap, i, heap->items[heap->size]);
+    thUpdate(heap, heap->items[i]);
+}
+
+/**
+ * @brief Değişen anahtara göre görevi yukarı ya da aşağı kaydırır.
+ */
+void thUpdate(TaskHeap* heap, SimulationTask* task) {
+    int i = task->policyIndex;
+    if (i < 0) {
+        return;
+    }
+
+    if (i > 0 && heap->less(task, heap->items[(i - 1) / 2])) {
+        thSiftUp(heap, i);
+    }
+    else {
+        thSiftDown(heap, i);
+    }
+}
+
+/**
+ * @brief En küçük görev.
+ */
+SimulationTask* thPeek(const TaskHeap* heap) {
+    return heap->size > 0 ? heap->items[0] : NULL;
+}
+
+/**
+ * @brief skip dışındaki en küçük görev (bkz. task_heap.h).
+ */
+SimulationTask* thFirstExcept(const TaskHeap* heap, const SimulationTask* skip) {
+    if (heap->size == 0) {
+        return NULL;
+    }
+    if (heap->items[0] != skip) {
+        return heap->items[0];
+    }
+    if (heap->size == 1) {
+        return NULL;
+    }
+    if (heap->size > 2 && heap->less(heap->items[2], heap->items[1])) {
+        return heap->items[2];
+    }
+    return heap->items[1];
+}
@@ -0,0 +1,60 @@
+#ifndef TASK_HEAP_H
+#define TASK_HEAP_H
+
+#include "scheduler.h"
+
+/**
+ * @brief a görevi b'den önce mi çıkmalı? (heap sıralaması; kesin ve tutarlı olmalı)
+ */
+typedef int (*TaskHeapLess)(const SimulationTask* a, const SimulationTask* b);
+
+/**
+ * @brief Politikaların hazır kümeleri için anahtarı değiştirilebilir indeksli min-heap.
+ *
+ * DeadlineHeap ile aynı yapıdadır; ancak sıralama kuralı dışarıdan (less) verilir ve
+ * görevin konumu SimulationTask.policyIndex alanında tutulur. Böylece bir politika
+ * (EDF'de mutlak deadline, SRTF'de kalan süre gibi) kendi anahtarıyla çalışırken
+ * zaman aşımı heap'i (heapIndex) bağımsız kalır. Ekleme, silme ve anahtar güncellemesi
+ * O(log n), en küçüğe erişim O(1)'dir. Bir görev aynı anda tek bir TaskHeap'te olabilir.
+ */
+typedef struct {
+    SimulationTask** items;  // Heap dizisi (items[0] en küçük)
+    int size;                // Heap'teki görev sayısı
+    int capacity;            // items dizisinin kapasitesi
+    TaskHeapLess less;       // Sıralama kuralı
+} TaskHeap;
+
+/**
+ * @brief Verilen sıralama kuralıyla boş bir heap hazırlar.
+ */
+void thInit(TaskHeap* heap, TaskHeapLess less);
+
+/**
+ * @brief Görevi heap'e ekler.
+ */
+void thPush(TaskHeap* heap, SimulationTask* task);
+
+/**
+ * @brief Görevi heap'ten çıkarır (heap'te değilse bir şey yapmaz).
+ */
+void thRemove(TaskHeap* heap, SimulationTask* task);
+
+/**
+ * @brief Görevin anahtarı değiştikten sonra heap içindeki yerini düzeltir.
+ */
+void thUpdate(TaskHeap* heap, SimulationTask* task);
+
+/**
+ * @brief En küçük görevi döndürür (heap boşsa NULL).
+ */
+SimulationTask* thPeek(const TaskHeap* heap);
+
+/**
+ * @brief skip dışındaki en küçük görevi döndürür (yoksa NULL).
+ *
+ * skip kökteyse ikinci en küçük kökün çocuklarından biridir; maliyet O(1)'dir.
+ * İş çalma için: kurban çekirdeğin o an çalıştırdığı görev atlanır.
+ */
+SimulationTask* thFirstExcept(const TaskHeap* heap, const SimulationTask* skip);
+
+#endif
@@ -0,0 +1,299 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sched.h>
+#include <time.h>
+#include "task_log.h"
+#include "varint.h"
+
+#define LOG_RING_CAPACITY 8192       // Halkadaki kayıt sayısı (2'nin kuvveti olmalı)
+#define LOG_BATCH_BYTES   (64u << 10) // Yazıcının tek seferde stdout'a verdiği en fazla bayt
+#define LOG_LINE_MAX      256         // Tek log satırının (ya da başlıkla birlikte kodlanmış olayın) üst sınırı
+#define LOG_IDLE_SLEEP_NS 1000000L    // Halka boşken yazıcının uyuma süresi (1 ms)
+
+// ANSI renk kodları (terminal çıktısını renklendirmek için)
+#define COLOR_RESET   "\033[0m"
+#define COLOR_BLUE    "\033[1;34m"
+#define COLOR_RED     "\033[1;31m"
+#define COLOR_GREEN   "\033[1;32m"
+#define COLOR_YELLOW  "\033[1;33m"
+#define COLOR_MAGENTA "\033[1;35m"
+#define COLOR_CYAN    "\033[1;36m"
+#define COLOR_BEIGE   "\033[38;5;230m"
+
+// Görev ID'sine göre kullanılacak renk dizisi (id % 6 ile seçiliyor)
+const char* TASK_COLORS[] = {
+    COLOR_BLUE, COLOR_RED, COLOR_GREEN,
+    COLOR_YELLOW, COLOR_MAGENTA, COLOR_CYAN
+};
+
+// TaskLogEvent sırasıyla durum metinleri
+static const char* const TASK_LOG_EVENT_NAMES[TASK_LOG_EVENT_COUNT] = {
+    "başladı", "yürütülüyor", "askıda", "sonlandı", "zamanaşımı"
+};
+
+// === Tek üretici / tek tüketici halka ===
+// head yalnızca üretici (controller), tail yalnızca yazıcı tarafından ilerletilir.
+// Sayaçlar hiç sarmaz; dolu/boş farkı head - tail ile anlaşılır.
+static TaskLogRecord ring[LOG_RING_CAPACITY];
+static unsigned long ringHead = 0;     // Eklenen toplam kayıt
+static unsigned long ringTail = 0;     // Biçimlendirilmiş (tampona alınmış) toplam kayıt
+static unsigned long ringWritten = 0;  // stdout'a yazılıp boşaltılmış toplam kayıt
+static unsigned long droppedCount = 0; // Taşma nedeniyle atılan kayıt
+static LogOverflowPolicy overflowPolicy = LOG_OVERFLOW_BLOCK;
+static int logStarted = 0;
+static int logDisabled = 0;            // 1 ise kayıtlar sessizce atılır (bkz. logDisable)
+
+// === İkili olay logu kipi ===
+static FILE* eventFile = NULL;     // NULL değilse satırlar yerine kodlanmış olaylar buraya yazılır
+static int eventHeaderWritten = 0; // Başlık ilk olayla birlikte yazılır
+static SimTime eventPrevTime = 0;  // Zaman farkı kodlaması için son yazılan olayın zamanı
+
+static void shortSleep(long ns) {
+    struct timespec ts = { 0, ns };
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief Kaydı renkli log satırına çevirir (bkz. task_log.h).
+ */
+size_t formatTaskLog(char* out, size_t capacity, const TaskLogRecord* record) {
+    const char* color = TASK_COLORS[record->id % 6];
+    const char* status = record->event < TASK_LOG_EVENT_COUNT ? TASK_LOG_EVENT_NAMES[record->event] : "?";
+    uint64_t magnitude = record->time < 0 ? (uint64_t)0 - (uint64_t)record->time : (uint64_t)record->time;
+    char remaining[32];
+
+    simFormatSeconds(remaining, sizeof(remaining), record->remainingTime);
+
+    // \t kaldırıldı (bazı terminallerde satır kayması/kesilme sorununu azaltmak için)
+    // Hizalama: %-6s (isim) ve %-13s (durum) alanları sabit genişlikte yazılır
+    int n = snprintf(out, capacity, "%s%s%llu.%0*llu sn %-6s %-13s (id:%04d  öncelik:%d  kalan süre:%s sn)%s\n",
+        color,
+        record->time < 0 ? "-" : "",
+        (unsigned long long)(magnitude / SIM_TICKS_PER_SEC),
+        SIM_TIME_DIGITS,
+        (unsigned long long)(magnitude % SIM_TICKS_PER_SEC),
+        record->name,
+        status,
+        record->id,
+        record->priority,
+        remaining,
+        COLOR_RESET);
+
+    if (n < 0) {
+        return 0;
+    }
+    return (size_t)n < capacity ? (size_t)n : capacity - 1;
+}
+
+/**
+ * @brief Olayı ikili biçimde kodlar (bkz. task_log.h).
+ */
+size_t encodeTaskLog(uint8_t* out, SimTime prevTime, const TaskLogRecord* record) {
+    size_t n = 0;
+
+    out[n++] = record->event;
+    n += putVarint(out + n, zigzagEncode64((int64_t)((uint64_t)record->time - (uint64_t)prevTime)));
+    n += putVarint(out + n, zigzagEncode(record->id));
+    n += putVarint(out + n, zigzagEncode(record->priority));
+    n += putVarint(out + n, zigzagEncode64(record->remainingTime));
+    return n;
+}
+
+/**
+ * @brief İkili olayı çözer (bkz. task_log.h).
+ */
+int decodeTaskLog(const uint8_t** p, const uint8_t* end, SimTime prevTime, TaskLogRecord* record) {
+    const uint8_t* q = *p;
+    uint64_t delta, id, priority, remaining;
+
+    if (q >= end || *q >= TASK_LOG_EVENT_COUNT) {
+        return 0;
+    }
+    record->event = *q++;
+
+    if (!getVarint(&q, end, &delta) || !getVarint(&q, end, &id) ||
+        !getVarint(&q, end, &priority) || !getVarint(&q, end, &remaining)) {
+        return 0;
+    }
+
+    record->time = (SimTime)((uint64_t)prevTime + (uint64_t)zigzagDecode64(delta));
+    record->id = zigzagDecode((uint32_t)id);
+    record->priority = zigzagDecode((uint32_t)priority);
+    record->remainingTime = zigzagDecode64(remaining);
+    *p = q;
+    return 1;
+}
+
+/**
+ * @brief Kaydı yazıcının tamponuna ekler: metin kipinde renkli satır, olay logu kipinde kodlanmış olay.
+ */
+static size_t appendRecord(char* out, const TaskLogRecord* record) {
+    size_t n = 0;
+
+    if (eventFile == NULL) {
+        return formatTaskLog(out, LOG_LINE_MAX, record);
+    }
+
+    if (!eventHeaderWritten) {
+        EventLogHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, EVENT_LOG_MAGIC, 8);
+        header.version = EVENT_LOG_VERSION;
+        memcpy(header.name, record->name, sizeof(header.name));
+        memcpy(out, &header, sizeof(header));
+        n = sizeof(header);
+        eventHeaderWritten = 1;
+    }
+
+    n += encodeTaskLog((uint8_t*)out + n, eventPrevTime, record);
+    eventPrevTime = record->time;
+    return n;
+}
+
+/**
+ * @brief Yazıcı iş parçacığı: halkadaki kayıtları biçimlendirip (ya da kodlayıp) toplu halde yazar.
+ *
+ * Halka boşaldığında ya da tampon dolduğunda tek fwrite + fflush yapılır; satır başına
+ * sistem çağrısı yoktur.
+ */
+static void* logWriterThread(void* arg) {
+    static char batch[LOG_BATCH_BYTES];
+    FILE* out = eventFile != NULL ? eventFile : stdout;
+    size_t used = 0;
+    (void)arg;
+
+    for (;;) {
+        unsigned long tail = ringTail;
+        unsigned long head = __atomic_load_n(&ringHead, __ATOMIC_ACQUIRE);
+
+        if (tail == head) {
+            if (used > 0) {
+                fwrite(batch, 1, used, out);
+                fflush(out);
+                used = 0;
+                __atomic_store_n(&ringWritten, tail, __ATOMIC_RELEASE);
+                continue;
+            }
+            shortSleep(LOG_IDLE_SLEEP_NS);
+            continue;
+        }
+
+        while (tail != head && used + LOG_LINE_MAX <= LOG_BATCH_BYTES) {
+            used += appendRecord(batch + used, &ring[tail & (LOG_RING_CAPACITY - 1)]);
+            tail++;
+        }
+        __atomic_store_n(&ringTail, tail, __ATOMIC_RELEASE);
+
+        if (used + LOG_LINE_MAX > LOG_BATCH_BYTES) {
+            fwrite(batch, 1, used, out);
+            used = 0;
+            __atomic_store_n(&ringWritten, tail, __ATOMIC_RELEASE);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief İkili olay logu dosyasını açar (bkz. task_log.h).
+ */
+void logSetEventFile(const char* path) {
+    eventFile = fopen(path, "wb");
+    if (eventFile == NULL) {
+        printf("Hata: %s dosyasi yazilamadi.\n", path);
+        exit(1);
+    }
+}
+
+static void logFlushAtExit(void) {
+    logFlush();
+}
+
+/**
+ * @brief Log halkasını kurar ve yazıcı iş parçacığını başlatır (bkz. task_log.h).
+ */
+void logInit(LogOverflowPolicy policy) {
+    pthread_t writer;
+    sigset_t all, old;
+
+    if (logStarted) {
+        return;
+    }
+    overflowPolicy = policy;
+
+    // Yazıcı FreeRTOS port'unun SIGALRM/SIG_RESUME sinyallerini hiç almamalı
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+    if (pthread_create(&writer, NULL, logWriterThread, NULL) != 0) {
+        printf("Hata: log yazici is parcacigi baslatilamadi.\n");
+        exit(1);
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+    pthread_detach(writer);
+
+    logStarted = 1;
+    atexit(logFlushAtExit);
+}
+
+/**
+ * @brief Kaydı halkaya ekler (bkz. task_log.h).
+ */
+void logPush(const TaskLogRecord* record) {
+    unsigned long head = ringHead;
+
+    if (logDisabled) {
+        return;
+    }
+
+    // Yazıcı başlatılmadıysa (logInit çağrılmadı) eski davranış: satır hemen yazılır
+    if (!logStarted) {
+        char line[LOG_LINE_MAX];
+        fwrite(line, 1, appendRecord(line, record), eventFile != NULL ? eventFile : stdout);
+        return;
+    }
+
+    while (head - __atomic_load_n(&ringTail, __ATOMIC_ACQUIRE) >= LOG_RING_CAPACITY) {
+        if (overflowPolicy == LOG_OVERFLOW_DROP) {
+            droppedCount++;
+            return;
+        }
+        sched_yield();
+    }
+
+    ring[head & (LOG_RING_CAPACITY - 1)] = *record;
+    __atomic_store_n(&ringHead, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Sonraki kayıtları kapatır (bkz. task_log.h).
+ */
+void logDisable(void) {
+    logDisabled = 1;
+}
+
+int logEnabled(void) {
+    return !logDisabled;
+}
+
+/**
+ * @brief Halka ve stdout boşalana kadar bekler (bkz. task_log.h).
+ */
+void logFlush(void) {
+    if (!logStarted) {
+        fflush(stdout);
+        return;
+    }
+    while (__atomic_load_n(&ringWritten, __ATOMIC_ACQUIRE) != ringHead) {
+        shortSleep(LOG_IDLE_SLEEP_NS / 10);
+    }
+}
+
+unsigned long logDroppedCount(void) {
+    return droppedCount;
+}
+
+LogOverflowPolicy logPolicy(void) {
+    return overflowPolicy;
+}
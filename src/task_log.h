@@ -0,0 +1,146 @@
+#ifndef TASK_LOG_H
+#define TASK_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sim_time.h"
+
+#define EVENT_LOG_MAGIC      "ISLEVLOG" // İkili olay logu imzası (8 bayt)
+#define EVENT_LOG_VERSION    2          // Yazılan olay logu sürümü (2: zamanlar tick)
+#define EVENT_LOG_VERSION_SECONDS 1     // Eski sürüm (zamanlar tam saniye); event_decode hâlâ okur
+#define EVENT_LOG_MAX_RECORD 32         // Kodlanmış tek olayın alabileceği en fazla bayt
+
+/**
+ * @brief Log satırına yol açan görev olayı (satırdaki durum metni).
+ */
+typedef enum {
+    TASK_LOG_STARTED = 0, // "başladı"
+    TASK_LOG_RUNNING,     // "yürütülüyor"
+    TASK_LOG_SUSPENDED,   // "askıda"
+    TASK_LOG_FINISHED,    // "sonlandı"
+    TASK_LOG_TIMEOUT,     // "zamanaşımı"
+    TASK_LOG_EVENT_COUNT
+} TaskLogEvent;
+
+/**
+ * @brief Log halkasına yazılan sabit boyutlu kayıt.
+ *
+ * printTaskLog yalnızca bu kaydı doldurur; metin biçimlendirme ve konsola yazma
+ * ayrı yazıcı iş parçacığında yapılır (bkz. logPush).
+ */
+typedef struct {
+    SimTime time;          // globalTimer (tick)
+    int id;
+    int priority;
+    SimTime remainingTime; // Kalan süre (tick)
+    unsigned char event;  // TaskLogEvent
+    char name[16];
+} TaskLogRecord;
+
+/**
+ * @brief İkili olay logunun sabit başlığı (32 bayt).
+ *
+ * Başlıktan sonra dosya sonuna kadar olay kayıtları gelir. Her kayıt:
+ * - 1 bayt olay (TaskLogEvent)
+ * - zaman farkı: önceki olayın zamanına göre zigzag varint, tick (ilk olay için 0'a göre)
+ * - id, öncelik, kalan süre (tick): zigzag varint
+ *
+ * Sürüm 1 (EVENT_LOG_VERSION_SECONDS) aynı düzendedir; zaman ve kalan süre tick yerine
+ * tam saniyedir. Simülatör yalnızca güncel sürümü yazar, tools/event_decode ikisini de okur.
+ *
+ * Görev adı kayıtlarda tutulmaz; tüm görevler aynı adı taşıdığından (initTaskRecord)
+ * ilk olaydaki ad başlığa bir kez yazılır. Başlık ilk olayla birlikte yazılır; hiç olay
+ * yoksa dosya boş kalır.
+ */
+typedef struct {
+    char magic[8];      // EVENT_LOG_MAGIC
+    uint32_t version;   // EVENT_LOG_VERSION
+    uint32_t reserved;  // Ayrılmış (0)
+    char name[16];      // Görev adı
+} EventLogHeader;
+
+/**
+ * @brief Halka dolduğunda ne yapılacağı.
+ */
+typedef enum {
+    LOG_OVERFLOW_BLOCK = 0, // Üretici yer açılana kadar bekler (hiç satır kaybolmaz, varsayılan)
+    LOG_OVERFLOW_DROP       // Kayıt atılır ve sayılır (scheduler hiç beklemez)
+} LogOverflowPolicy;
+
+/**
+ * @brief Kaydı renkli log satırına çevirir.
+ *
+ * Biçim: "<renk><zaman> sn <isim> <durum> (id:xxxx  öncelik:x  kalan süre:x sn)<reset>\n"
+ * Zaman her zaman SIM_TIME_DIGITS ondalıkla ("2.2500"), kalan süre sondaki sıfırlar
+ * atılarak ("2", "0.75") yazılır; tam saniyelik girişte çıktı eski biçimle aynıdır.
+ *
+ * @return Yazılan bayt sayısı (sonlandırıcı hariç)
+ */
+size_t formatTaskLog(char* out, size_t capacity, const TaskLogRecord* record);
+
+/**
+ * @brief Olayı ikili olay logu biçiminde kodlar (bkz. EventLogHeader).
+ *
+ * @param out      En az EVENT_LOG_MAX_RECORD baytlık hedef
+ * @param prevTime Önceki olayın zamanı (ilk olayda 0)
+ * @return Yazılan bayt sayısı
+ */
+size_t encodeTaskLog(uint8_t* out, SimTime prevTime, const TaskLogRecord* record);
+
+/**
+ * @brief *p konumundaki olayı çözer ve *p'yi ilerletir (name alanı doldurulmaz).
+ *
+ * @return Başarılıysa 1; kayıt kesik ya da bozuksa 0
+ */
+int decodeTaskLog(const uint8_t** p, const uint8_t* end, SimTime prevTime, TaskLogRecord* record);
+
+/**
+ * @brief Log satırları yerine ikili olay logunun yazılacağı dosyayı seçer (logInit'ten önce).
+ *
+ * Bu kipte yazıcı biçimlendirme yapmaz; kayıtları kodlayıp dosyaya ekler. Renkli satırlar
+ * sonradan tools/event_decode ile birebir aynı haliyle üretilebilir. Özet yine stdout'a basılır.
+ */
+void logSetEventFile(const char* path);
+
+/**
+ * @brief Log halkasını kurar ve yazıcı iş parçacığını başlatır.
+ *
+ * Yazıcı bir host (pthread) iş parçacığıdır; FreeRTOS görevi değildir ve port'un tick
+ * sinyallerini almaması için tüm sinyaller kapalı yaratılır. Program nasıl sonlanırsa
+ * sonlansın (exit) halkada kalan kayıtlar atexit ile boşaltılır.
+ */
+void logInit(LogOverflowPolicy policy);
+
+/**
+ * @brief Kaydı halkaya ekler (tek üretici, kilitsiz).
+ */
+void logPush(const TaskLogRecord* record);
+
+/**
+ * @brief Bundan sonraki kayıtları yazmadan atar (sayılmaz).
+ *
+ * Parametre taramasının çalıştırmaları log basmaz (bkz. sweep.h).
+ */
+void logDisable(void);
+
+/**
+ * @brief Kayıtlar yazılıyor mu (logDisable çağrılmadıysa 1)?
+ */
+int logEnabled(void);
+
+/**
+ * @brief Halkadaki tüm kayıtlar yazılıp stdout boşaltılana kadar bekler.
+ */
+void logFlush(void);
+
+/**
+ * @brief LOG_OVERFLOW_DROP kipinde atılan kayıt sayısı.
+ */
+unsigned long logDroppedCount(void);
+
+/**
+ * @brief Etkin taşma politikası.
+ */
+LogOverflowPolicy logPolicy(void);
+
+#endif
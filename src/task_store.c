@@ -0,0 +1,144 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "task_store.h"
+
+/**
+ * @brief Sıcak parçanın başlığı: parçanın ilk kaydının yerini kaplar, görevler ondan sonra başlar.
+ */
+typedef union {
+    SimulationTaskCold* cold; // Aynı parçanın soğuk kayıtları
+    SimulationTask pad;       // Görevlerin kayıt sınırında başlaması için
+} TaskStoreChunkHeader;
+
+/**
+ * @brief Boş bir arena hazırlar.
+ */
+void tsInit(TaskStore* store) {
+    store->chunks = NULL;
+    store->coldChunks = NULL;
+    store->chunkCount = 0;
+    store->chunkCapacity = 0;
+    store->count = 0;
+    store->live = 0;
+    store->freeList = NULL;
+}
+
+/**
+ * @brief Yeni bir görev kaydı ayırır; serbest yuva yoksa ve son parça doluysa yeni parça eklenir.
+ */
+SimulationTask* tsAlloc(TaskStore* store) {
+    if (store->freeList != NULL) {
+        SimulationTask* task = store->freeList;
+        store->freeList = task->rqNext;
+        store->live++;
+        return task;
+    }
+
+    int offset = store->count % TASK_STORE_CHUNK_SIZE;
+
+    if (offset == 0 && store->count / TASK_STORE_CHUNK_SIZE == store->chunkCount) {
+        // Dizin doluysa yalnızca pointer dizisi büyütülür (kayıtlar yerinde kalır)
+        if (store->chunkCount == store->chunkCapacity) {
+            int newCapacity = store->chunkCapacity ? store->chunkCapacity * 2 : 16;
+            SimulationTask** chunks = realloc(store->chunks, (size_t)newCapacity * sizeof(*chunks));
+            if (chunks) {
+                store->chunks = chunks;
+            }
+            SimulationTaskCold** coldChunks = realloc(store->coldChunks, (size_t)newCapacity * sizeof(*coldChunks));
+            if (coldChunks) {
+                store->coldChunks = coldChunks;
+            }
+            if (!chunks || !coldChunks) {
+                printf("Hata: gorev deposu icin bellek ayrilamadi.\n");
+                exit(1);
+            }
+            store->chunkCapacity = newCapacity;
+        }
+
+        // Sıcak parça kendi boyuna hizalanır; getTaskCold başlığı adresin alt bitlerini silerek bulur
+        SimulationTask* chunk = aligned_alloc(TASK_STORE_CHUNK_BYTES, TASK_STORE_CHUNK_BYTES);
+        SimulationTaskCold* coldChunk = calloc(TASK_STORE_CHUNK_SIZE, sizeof(SimulationTaskCold));
+        if (!chunk || !coldChunk) {
+            printf("Hata: gorev deposu icin bellek ayrilamadi.\n");
+            exit(1);
+        }
+        memset(chunk, 0, TASK_STORE_CHUNK_BYTES);
+        ((TaskStoreChunkHeader*)chunk)->cold = coldChunk;
+        store->chunks[store->chunkCount] = chunk;
+        store->coldChunks[store->chunkCount] = coldChunk;
+        store->chunkCount++;
+    }
+
+    SimulationTask* task = tsAt(store, store->count);
+    store->count++;
+    store->live++;
+    return task;
+}
+
+/**
+ * @brief Yuvayı serbest listenin başına ekler (yuvanın soğuk kaydı da onunla birlikte yeniden kullanılır).
+ */
+void tsRelease(TaskStore* store, SimulationTask* task) {
+    task->rqNext = store->freeList;
+    store->freeList = task;
+    store->live--;
+}
+
+/**
+ * @brief i. görevin adresi (parça numarası = i / SIZE, parça içi konum = i % SIZE; başlıktan sonra).
+ */
+SimulationTask* tsAt(const TaskStore* store, int i) {
+    return &store->chunks[i / TASK_STORE_CHUNK_SIZE][1 + i % TASK_STORE_CHUNK_SIZE];
+}
+
+/**
+ * @brief i. görevin soğuk kaydı (sıcak kayıtla aynı parça/konum).
+ */
+SimulationTaskCold* tsCold(const TaskStore* store, int i) {
+    return &store->coldChunks[i / TASK_STORE_CHUNK_SIZE][i % TASK_STORE_CHUNK_SIZE];
+}
+
+/**
+ * @brief Görevin soğuk kaydı (bkz. scheduler.h): hizalı parçanın başlığından, aynı parça içi konumda.
+ */
+SimulationTaskCold* getTaskCold(const SimulationTask* task) {
+    const SimulationTask* chunk =
+        (const SimulationTask*)((uintptr_t)task & ~(uintptr_t)(TASK_STORE_CHUNK_BYTES - 1));
+    return ((const TaskStoreChunkHeader*)chunk)->cold + (task - chunk - 1);
+}
+
+/**
+ * @brief Geliş zamanı, eşitse kimlik sırası (bkz. scheduler.h).
+ */
+int taskArrivedBefore(const SimulationTask* a, const SimulationTask* b) {
+    const SimulationTaskCold* ca = getTaskCold(a);
+    const SimulationTaskCold* cb = getTaskCold(b);
+    if (ca->arrivalTime != cb->arrivalTime) {
+        return ca->arrivalTime < cb->arrivalTime;
+    }
+    return ca->id < cb->id;
+}
+
+/**
+ * @brief Parçalar ve dizinler için ayrılmış toplam bellek.
+ */
+size_t tsMemoryUsage(const TaskStore* store) {
+    return (size_t)store->chunkCount *
+        (TASK_STORE_CHUNK_BYTES + TASK_STORE_CHUNK_SIZE * sizeof(SimulationTaskCold)) +
+        (size_t)store->chunkCapacity * (sizeof(SimulationTask*) + sizeof(SimulationTaskCold*));
+}
+
+/**
+ * @brief Tüm parçaları ve dizini serbest bırakır.
+ */
+void tsFree(TaskStore* store) {
+    for (int c = 0; c < store->chunkCount; c++) {
+        free(store->chunks[c]);
+        free(store->coldChunks[c]);
+    }
+    free(store->chunks);
+    free(store->coldChunks);
+    tsInit(store);
+}
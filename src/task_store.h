@@ -0,0 +1,77 @@
+#ifndef TASK_STORE_H
+#define TASK_STORE_H
+
+#include <stddef.h>
+#include "scheduler.h"
+
+#define TASK_STORE_CHUNK_BYTES 65536 // Sıcak parçanın boyu ve hizası (2'nin kuvveti olmalı)
+#define TASK_STORE_CHUNK_SIZE  ((int)(TASK_STORE_CHUNK_BYTES / sizeof(SimulationTask)) - 1) // Parça başına görev (ilk kayıt başlık)
+
+/**
+ * @brief Sınırsız sayıda SimulationTask tutan parçalı (chunked) arena.
+ *
+ * Görevler sabit boyutlu parçalara yerleştirilir; yeni parça gerektiğinde yalnızca
+ * parça dizini (pointer dizisi) büyür, mevcut kayıtlar asla taşınmaz/kopyalanmaz.
+ * Bu yüzden tsAlloc'un döndürdüğü adresler simülasyon boyunca geçerli kalır
+ * (hazır kuyrukları ve deadline heap'i bu adresleri tutar).
+ *
+ * Sıcak kayıtlar (SimulationTask) ve soğuk kayıtlar (SimulationTaskCold) aynı indeksle
+ * ayrı parçalarda tutulur; böylece scheduler döngüleri isim/handle baytlarını önbelleğe
+ * taşımaz. Sıcak parçalar TASK_STORE_CHUNK_BYTES sınırına hizalanır ve ilk kayıt
+ * büyüklüğündeki başlıkta soğuk parçanın adresini tutar; getTaskCold bir görevin soğuk
+ * kaydını yalnızca sıcak kaydın adresinden bulur (kayıtta yuva indeksi gerekmez).
+ *
+ * tsRelease ile geri verilen yuvalar intrusive bir serbest listede (rqNext bağı üzerinden)
+ * tutulur ve tsAlloc önce bu listeden verir; böylece arena en fazla aynı anda canlı olan
+ * görev sayısı kadar büyür.
+ */
+typedef struct {
+    SimulationTask** chunks;  // Parça dizini (sıcak kayıtlar; her parçanın ilk kaydı başlık)
+    SimulationTaskCold** coldChunks; // Parça dizini (soğuk kayıtlar, chunks ile aynı düzen)
+    int chunkCount;           // Ayrılmış parça sayısı
+    int chunkCapacity;        // Parça dizininin kapasitesi
+    int count;                // Şimdiye kadar açılmış yuva sayısı (en yüksek seviye)
+    int live;                 // Şu an kullanımda olan yuva sayısı
+    SimulationTask* freeList; // Geri verilmiş yuvalar (rqNext ile bağlı)
+} TaskStore;
+
+/**
+ * @brief Boş bir arena hazırlar.
+ */
+void tsInit(TaskStore* store);
+
+/**
+ * @brief Bir görev yuvası ayırır (önce serbest listeden, yoksa arenanın sonundan).
+ *
+ * Kaydın alanlarını çağıran doldurur (soğuk kayıt getTaskCold ile bulunur).
+ *
+ * @return Kaydın kalıcı adresi (tsRelease edilene kadar geçerli)
+ */
+SimulationTask* tsAlloc(TaskStore* store);
+
+/**
+ * @brief Yuvayı serbest listeye geri verir; sonraki tsAlloc tarafından yeniden kullanılır.
+ */
+void tsRelease(TaskStore* store, SimulationTask* task);
+
+/**
+ * @brief i. göreve (ekleme sırasına göre) O(1) erişim.
+ */
+SimulationTask* tsAt(const TaskStore* store, int i);
+
+/**
+ * @brief i. görevin soğuk kaydına O(1) erişim.
+ */
+SimulationTaskCold* tsCold(const TaskStore* store, int i);
+
+/**
+ * @brief Arenanın ayırdığı toplam bellek (parçalar + dizin), bayt cinsinden.
+ */
+size_t tsMemoryUsage(const TaskStore* store);
+
+/**
+ * @brief Arenanın tüm belleğini serbest bırakır.
+ */
+void tsFree(TaskStore* store);
+
+#endif
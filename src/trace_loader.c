@@ -0,0 +1,323 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "trace_loader.h"
+#include "varint.h"
+
+#define TRACE_RELEASE_BYTES (4u << 20) // Okunan bölge bu kadar büyüyünce sayfaları bırak
+
+/**
+ * @brief Dosyayı açar ve salt okunur olarak belleğe eşler.
+ */
+void trOpen(TraceReader* reader, const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        printf("Hata: %s dosyasi acilamadi.\n", path);
+        exit(1);
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        printf("Hata: %s dosyasi okunamadi.\n", path);
+        exit(1);
+    }
+
+    reader->path = path;
+    reader->size = (size_t)st.st_size;
+    reader->pos = 0;
+    reader->line = 0;
+    reader->released = 0;
+    reader->data = NULL;
+
+    // Boş dosya eşlenemez; sıfır görevli geçerli bir giriş olarak kabul edilir
+    if (reader->size > 0) {
+        void* data = mmap(NULL, reader->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            printf("Hata: %s dosyasi bellege eslenemedi.\n", path);
+            exit(1);
+        }
+        madvise(data, reader->size, MADV_SEQUENTIAL);
+        reader->data = data;
+    }
+    close(fd);
+
+    reader->binary = 0;
+    reader->binVersion = 0;
+    reader->binRemaining = 0;
+    reader->binPrevArrival = 0;
+
+    // İkili biçim algılama: sabit imza ile başlıyorsa başlık doğrulanır
+    if (reader->size >= 8 && memcmp(reader->data, TRACE_BIN_MAGIC, 8) == 0) {
+        TraceBinHeader header;
+        if (reader->size < sizeof(header)) {
+            printf("Hata: %s: ikili iz basligi eksik.\n", path);
+            exit(1);
+        }
+        memcpy(&header, reader->data, sizeof(header));
+        if (header.version < 1 || header.version > TRACE_BIN_VERSION) {
+            printf("Hata: %s: desteklenmeyen ikili iz surumu %u.\n", path, header.version);
+            exit(1);
+        }
+
+        reader->binary = 1;
+        reader->binVersion = (int)header.version;
+        reader->binRemaining = header.recordCount;
+        // Sürüm 1'de taban 32 bitlik saniyedir (üst 32 bit ayrılmış alandı)
+        reader->binPrevArrival = header.version == 1 ? (SimTime)(int32_t)header.firstArrival : header.firstArrival;
+        reader->pos = sizeof(header);
+        return;
+    }
+
+    // UTF-8 BOM (Windows editörleri) atlanır
+    if (reader->size >= 3 && memcmp(reader->data, "\xEF\xBB\xBF", 3) == 0) {
+        reader->pos = 3;
+    }
+}
+
+/**
+ * @brief Okuyucunun konumundan varint okur (bkz. varint.h).
+ */
+static int readVarint(TraceReader* reader, uint64_t* out) {
+    const uint8_t* p = (const uint8_t*)reader->data + reader->pos;
+    const uint8_t* end = (const uint8_t*)reader->data + reader->size;
+
+    if (!getVarint(&p, end, out)) {
+        return 0;
+    }
+    reader->pos = (size_t)(p - (const uint8_t*)reader->data);
+    return 1;
+}
+
+/**
+ * @brief İkili biçimde sıradaki kaydı çözer.
+ */
+static int trNextBinary(TraceReader* reader, TraceRecord* record) {
+    if (reader->binRemaining == 0) {
+        return 0;
+    }
+
+    uint64_t delta, packed, extra, deadline;
+    reader->line++;
+
+    if (!readVarint(reader, &delta) || !readVarint(reader, &packed)) {
+        printf("Hata: %s: kayit %d kesik ya da bozuk.\n", reader->path, reader->line);
+        exit(1);
+    }
+
+    int priority = (int)(packed & 0xF);
+    if (priority == 15) {
+        if (!readVarint(reader, &extra)) {
+            printf("Hata: %s: kayit %d kesik ya da bozuk.\n", reader->path, reader->line);
+            exit(1);
+        }
+        priority = zigzagDecode((uint32_t)extra);
+    }
+
+    reader->binRemaining--;
+    record->priority = priority;
+    record->deadline = TRACE_NO_DEADLINE;
+
+    if (reader->binVersion == 1) {
+        // Sürüm 1: 32 bitlik tam saniyeler
+        reader->binPrevArrival = (int32_t)((uint32_t)reader->binPrevArrival + (uint32_t)zigzagDecode((uint32_t)delta));
+        record->arrivalTime = simSeconds(reader->binPrevArrival);
+        record->burstTime = simSeconds(zigzagDecode((uint32_t)(packed >> 4)));
+        return 1;
+    }
+
+    reader->binPrevArrival = (SimTime)((uint64_t)reader->binPrevArrival + (uint64_t)zigzagDecode64(delta));
+    record->arrivalTime = reader->binPrevArrival;
+
+    if (reader->binVersion == 2) {
+        record->burstTime = zigzagDecode64(packed >> 4);
+        return 1;
+    }
+
+    record->burstTime = zigzagDecode64(packed >> 5);
+    if (packed & 0x10) {
+        if (!readVarint(reader, &deadline) || deadline > (uint64_t)INT64_MAX) {
+            printf("Hata: %s: kayit %d kesik ya da bozuk.\n", reader->path, reader->line);
+            exit(1);
+        }
+        record->deadline = (SimTime)deadline;
+    }
+    return 1;
+}
+
+/**
+ * @brief Satır içindeki boşluk/tab karakterlerini atlar.
+ */
+static const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t')) {
+        p++;
+    }
+    return p;
+}
+
+/**
+ * @brief İşaretli onluk tamsayı ayrıştırır.
+ *
+ * @return Başarılıysa sayıdan sonraki konum, sayı yoksa/taşarsa NULL
+ */
+static const char* parseInt(const char* p, const char* end, int* out) {
+    int negative = 0;
+    long value = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p >= end || (unsigned)(*p - '0') > 9) {
+        return NULL;
+    }
+    while (p < end && (unsigned)(*p - '0') <= 9) {
+        value = value * 10 + (*p - '0');
+        if (value > 2147483647L) {
+            return NULL;
+        }
+        p++;
+    }
+
+    *out = (int)(negative ? -value : value);
+    return p;
+}
+
+/**
+ * @brief Okunup geçilmiş, sayfa hizalı bölgeyi çekirdeğe geri verir.
+ */
+static void releaseConsumed(TraceReader* reader) {
+    static size_t page = 0;
+    if (page == 0) {
+        page = (size_t)sysconf(_SC_PAGESIZE);
+    }
+    size_t upto = reader->pos & ~(page - 1);
+
+    if (upto - reader->released >= TRACE_RELEASE_BYTES) {
+        madvise((void*)(reader->data + reader->released), upto - reader->released, MADV_DONTNEED);
+        reader->released = upto;
+    }
+}
+
+/**
+ * @brief Sıradaki boş olmayan satırı ayrıştırır (bkz. trace_loader.h).
+ */
+int trNext(TraceReader* reader, TraceRecord* record) {
+    const char* base = reader->data;
+
+    if (reader->binary) {
+        int ok = trNextBinary(reader, record);
+        releaseConsumed(reader);
+        return ok;
+    }
+
+    while (reader->pos < reader->size) {
+        const char* p = base + reader->pos;
+        const char* fileEnd = base + reader->size;
+        const char* end = memchr(p, '\n', (size_t)(fileEnd - p));
+        if (end == NULL) {
+            end = fileEnd;
+        }
+
+        reader->pos = (size_t)(end - base) + (end < fileEnd ? 1 : 0);
+        reader->line++;
+        releaseConsumed(reader);
+
+        // CRLF satır sonu
+        if (end > p && end[-1] == '\r') {
+            end--;
+        }
+
+        p = skipBlanks(p, end);
+        if (p == end) {
+            continue; // boş satır
+        }
+
+        // Alanlar: geliş (saniye, kesirli olabilir), öncelik (tamsayı), süre (saniye),
+        // isteğe bağlı göreli deadline (saniye)
+        record->deadline = TRACE_NO_DEADLINE;
+        for (int f = 0; f < 4 && p != NULL; f++) {
+            if (f > 0) {
+                p = skipBlanks(p, end);
+                if (f == 3 && p == end) {
+                    break; // deadline sütunu yok
+                }
+                if (p >= end || *p != ',') {
+                    p = NULL;
+                    break;
+                }
+                p = skipBlanks(p + 1, end);
+            }
+            if (f == 0) {
+                p = simParseSeconds(p, end, &record->arrivalTime);
+            }
+            else if (f == 1) {
+                p = parseInt(p, end, &record->priority);
+            }
+            else if (f == 2) {
+                p = simParseSeconds(p, end, &record->burstTime);
+            }
+            else {
+                p = simParseSeconds(p, end, &record->deadline);
+                if (p != NULL && record->deadline < 0) {
+                    p = NULL;
+                }
+            }
+        }
+
+        if (p == NULL || skipBlanks(p, end) != end) {
+            printf("Hata: %s:%d: satir 'gelis, oncelik, sure[, deadline]' biciminde degil.\n",
+                reader->path, reader->line);
+            exit(1);
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief İkili biçim başlığını doldurur.
+ */
+void trInitBinHeader(TraceBinHeader* header, uint64_t recordCount, SimTime firstArrival) {
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, TRACE_BIN_MAGIC, 8);
+    header->version = TRACE_BIN_VERSION;
+    header->recordCount = recordCount;
+    header->firstArrival = firstArrival;
+}
+
+/**
+ * @brief Kaydı (geliş farkı, paketlenmiş öncelik/süre, varsa deadline) varint'leri olarak kodlar.
+ */
+size_t trEncodeRecord(uint8_t* out, SimTime prevArrival, const TraceRecord* record) {
+    size_t n = putVarint(out, zigzagEncode64((int64_t)((uint64_t)record->arrivalTime - (uint64_t)prevArrival)));
+    int hasDeadline = record->deadline != TRACE_NO_DEADLINE;
+    uint64_t packed = (zigzagEncode64(record->burstTime) << 5) | (hasDeadline ? 0x10u : 0u);
+
+    if (record->priority >= 0 && record->priority < 15) {
+        n += putVarint(out + n, packed | (uint64_t)record->priority);
+    }
+    else {
+        n += putVarint(out + n, packed | 15);
+        n += putVarint(out + n, zigzagEncode(record->priority));
+    }
+    if (hasDeadline) {
+        n += putVarint(out + n, (uint64_t)record->deadline);
+    }
+    return n;
+}
+
+/**
+ * @brief Eşlemeyi kaldırır.
+ */
+void trClose(TraceReader* reader) {
+    if (reader->data != NULL) {
+        munmap((void*)reader->data, reader->size);
+        reader->data = NULL;
+    }
+}
@@ -0,0 +1,112 @@
+#ifndef TRACE_LOADER_H
+#define TRACE_LOADER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sim_time.h"
+
+#define TRACE_BIN_MAGIC   "ISLTRACE" // İkili iz dosyası imzası (8 bayt)
+#define TRACE_BIN_VERSION 3          // Yazılan ikili biçim sürümü (1: tam saniye, 2: tick, 3: deadline)
+#define TRACE_BIN_MAX_RECORD 48      // Kodlanmış tek kaydın alabileceği en fazla bayt
+#define TRACE_NO_DEADLINE (-1)       // Kayıtta deadline sütunu yok
+
+/**
+ * @brief Giriş dosyasındaki tek bir satır (görev tanımı).
+ */
+typedef struct {
+    SimTime arrivalTime;  // Görevin sisteme giriş zamanı (tick)
+    int priority;         // Öncelik seviyesi (0 en yüksek, 5 en düşük)
+    SimTime burstTime;    // Görevin toplam CPU ihtiyacı (tick)
+    SimTime deadline;     // Gelişe göre göreli deadline (tick); yoksa TRACE_NO_DEADLINE
+} TraceRecord;
+
+/**
+ * @brief İkili iz dosyasının sabit başlığı (32 bayt, little-endian).
+ *
+ * Başlıktan sonra recordCount adet kayıt gelir. Her kayıt iki varint'ten oluşur:
+ * - geliş zamanı farkı: önceki kaydın arrivalTime'ına göre zigzag kodlu fark
+ *   (ilk kayıt için taban firstArrival'dır; sıralı girişte fark küçük ve pozitiftir)
+ * - paketlenmiş öncelik/süre: (zigzag(burstTime) << 5) | (deadline var mı << 4) | priority;
+ *   priority 0..14 dışında ise alt 4 bit 15 yazılır ve ardından zigzag(priority) ayrı bir
+ *   varint olarak gelir
+ * - deadline biti 1 ise: göreli deadline (tick) ayrı bir varint olarak gelir
+ *
+ * Sürüm 3'te zamanlar tick (SimTime), sürüm 1'de tam saniyedir (32 bit taban); sürüm 1
+ * dosyaları okunurken saniyeler tick'e çevrilir. Sürüm 1 ve 2'de deadline biti yoktur
+ * (paket yalnızca 4 bit sola kaydırılır). Tipik bir kayıt 3-5 bayt tutar; metin
+ * satırının ayrıştırılmasına gerek kalmaz.
+ */
+typedef struct {
+    char magic[8];          // TRACE_BIN_MAGIC
+    uint32_t version;       // TRACE_BIN_VERSION
+    uint32_t flags;         // Ayrılmış (0)
+    uint64_t recordCount;   // Kayıt sayısı
+    int64_t firstArrival;   // Geliş farklarının tabanı (sürüm 1'de alt 32 bit, saniye)
+} TraceBinHeader;
+
+/**
+ * @brief Belleğe eşlenmiş (mmap) giriş dosyası üzerinde satır satır okuyucu.
+ *
+ * Dosya tek seferde mmap ile eşlenir; satırlar stdio tamponlamasından geçmeden
+ * doğrudan eşlenmiş bayt dizisi üzerinde elle yazılmış bir tamsayı tarayıcıyla
+ * ayrıştırılır (kopya yok). Satır sonları memchr ile (glibc'de SIMD'li) bulunur.
+ * Okunup geçilen bölgeler parça parça madvise(MADV_DONTNEED) ile bırakılır; büyük bir
+ * dosya baştan sona okunurken RSS dosya boyutuyla büyümez.
+ *
+ * Dosya TRACE_BIN_MAGIC ile başlıyorsa ikili biçim olarak okunur (bkz. TraceBinHeader);
+ * aksi halde metin biçimi kabul edilir. Biçim trOpen sırasında otomatik algılanır.
+ */
+typedef struct {
+    const char* path;   // Dosya yolu (hata mesajları için)
+    const char* data;   // Eşlenmiş dosya içeriği
+    size_t size;        // Dosya boyutu (bayt)
+    size_t pos;         // Sıradaki okunacak baytın konumu
+    int line;           // Son okunan satırın numarası (1'den başlar)
+    size_t released;    // Çekirdeğe geri verilmiş (madvise) baştaki bayt sayısı
+
+    int binary;               // 1 ise ikili biçim
+    uint64_t binRemaining;    // İkili biçimde okunmamış kayıt sayısı
+    int binVersion;           // İkili biçim sürümü (1..3)
+    SimTime binPrevArrival;   // İkili biçimde son çözülen geliş zamanı (dosyanın biriminde)
+} TraceReader;
+
+/**
+ * @brief Dosyayı açar ve belleğe eşler. Açılamazsa hata basıp programı sonlandırır.
+ */
+void trOpen(TraceReader* reader, const char* path);
+
+/**
+ * @brief Sıradaki görev satırını (ikili biçimde kaydı) okur.
+ *
+ * Satır biçimi: "arrivalTime, priority, burstTime[, deadline]" (virgül çevresinde boşluk
+ * serbest, CRLF satır sonu kabul edilir). arrivalTime, burstTime ve isteğe bağlı deadline
+ * saniyedir ve en fazla SIM_TIME_DIGITS ondalık basamakla kesirli olabilir ("0.25");
+ * priority tamsayıdır. deadline gelişe göre görelidir (mutlak deadline = arrivalTime +
+ * deadline) ve negatif olamaz; sütun yoksa TRACE_NO_DEADLINE atanır. Boş satırlar atlanır. Hatalı satırda satır numarasıyla
+ * birlikte hata basılır ve program sonlandırılır. İkili biçimde line alanı kayıt
+ * numarasını tutar; kesik/bozuk kayıtta aynı şekilde hata verilir.
+ *
+ * @return Kayıt okunduysa 1, dosya sonunda 0
+ */
+int trNext(TraceReader* reader, TraceRecord* record);
+
+/**
+ * @brief Eşlemeyi kaldırır.
+ */
+void trClose(TraceReader* reader);
+
+/**
+ * @brief İkili biçim başlığını doldurur.
+ */
+void trInitBinHeader(TraceBinHeader* header, uint64_t recordCount, SimTime firstArrival);
+
+/**
+ * @brief Bir kaydı ikili biçimde kodlar (bkz. TraceBinHeader).
+ *
+ * @param out         En az TRACE_BIN_MAX_RECORD baytlık hedef
+ * @param prevArrival Önceki kaydın geliş zamanı (ilk kayıtta firstArrival)
+ * @return Yazılan bayt sayısı
+ */
+size_t trEncodeRecord(uint8_t* out, SimTime prevArrival, const TraceRecord* record);
+
+#endif
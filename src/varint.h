@@ -0,0 +1,68 @@
+#ifndef VARINT_H
+#define VARINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief İkili iz (trace_loader) ve ikili olay logu (task_log) için ortak tamsayı kodlaması.
+ *
+ * - zigzag: işaretli sayıyı, küçük mutlak değerler küçük kalacak şekilde işaretsize çevirir
+ * - varint: LEB128, bayt başına 7 bit; küçük değerler tek bayt tutar
+ */
+
+static inline uint32_t zigzagEncode(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static inline int32_t zigzagDecode(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+static inline uint64_t zigzagEncode64(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+static inline int64_t zigzagDecode64(uint64_t v) {
+    return (int64_t)(v >> 1) ^ -(int64_t)(v & 1);
+}
+
+/**
+ * @brief Varint yazar; out en az 10 bayt olmalıdır.
+ *
+ * @return Yazılan bayt sayısı
+ */
+static inline size_t putVarint(uint8_t* out, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+}
+
+/**
+ * @brief *p konumundan varint okur ve *p'yi ilerletir.
+ *
+ * @return Başarılıysa 1; veri bittiyse ya da 64 biti aşıyorsa 0 (*p değişmez)
+ */
+static inline int getVarint(const uint8_t** p, const uint8_t* end, uint64_t* out) {
+    const uint8_t* q = *p;
+    uint64_t value = 0;
+    int shift = 0;
+
+    while (q < end && shift < 64) {
+        uint8_t b = *q++;
+        value |= (uint64_t)(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *p = q;
+            *out = value;
+            return 1;
+        }
+        shift += 7;
+    }
+    return 0;
+}
+
+#endif
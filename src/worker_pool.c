@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "worker_pool.h"
+
+/**
+ * @brief Yeni bir işçi görevi yaratır; işçi ilk bildirimi bekleyerek başlar.
+ */
+static TaskHandle_t wpCreateWorker(WorkerPool* pool) {
+    TaskHandle_t worker = NULL;
+
+    if (xTaskCreate(vTaskGenericFunction, "worker", WORKER_STACK_DEPTH, pool->owner, 1, &worker) != pdPASS) {
+        printf("Hata: isci gorevi olusturulamadi.\n");
+        exit(1);
+    }
+
+    pool->size++;
+    return worker;
+}
+
+/**
+ * @brief İşçiyi boştakiler dizisine ekler (gerekirse diziyi büyütür).
+ */
+static void wpPushIdle(WorkerPool* pool, TaskHandle_t worker) {
+    if (pool->idleCount == pool->idleCapacity) {
+        int newCapacity = pool->idleCapacity > 0 ? pool->idleCapacity * 2 : 64;
+        TaskHandle_t* items = realloc(pool->idle, (size_t)newCapacity * sizeof(TaskHandle_t));
+        if (items == NULL) {
+            printf("Hata: isci havuzu icin bellek ayrilamadi.\n");
+            exit(1);
+        }
+        pool->idle = items;
+        pool->idleCapacity = newCapacity;
+    }
+    pool->idle[pool->idleCount++] = worker;
+}
+
+/**
+ * @brief Havuzu hazırlar ve işçileri önceden yaratır (bkz. worker_pool.h).
+ */
+void wpInit(WorkerPool* pool, int prewarm, TaskHandle_t owner) {
+    pool->idle = NULL;
+    pool->idleCount = 0;
+    pool->idleCapacity = 0;
+    pool->size = 0;
+    pool->acquires = 0;
+    pool->hits = 0;
+    pool->owner = owner;
+
+    for (int i = 0; i < prewarm; i++) {
+        wpPushIdle(pool, wpCreateWorker(pool));
+    }
+}
+
+/**
+ * @brief Boştaki bir işçiyi verir; yoksa yenisini yaratır (bkz. worker_pool.h).
+ */
+TaskHandle_t wpAcquire(WorkerPool* pool) {
+    pool->acquires++;
+
+    if (pool->idleCount > 0) {
+        pool->hits++;
+        return pool->idle[--pool->idleCount];
+    }
+    return wpCreateWorker(pool);
+}
+
+/**
+ * @brief İşçiyi havuza geri verir (bkz. worker_pool.h).
+ */
+void wpRelease(WorkerPool* pool, TaskHandle_t worker) {
+    wpPushIdle(pool, worker);
+}
+
+double wpHitRate(const WorkerPool* pool) {
+    return pool->acquires > 0 ? (double)pool->hits / pool->acquires : 0.0;
+}
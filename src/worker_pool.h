@@ -0,0 +1,56 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include "scheduler.h"
+
+#define WORKER_STACK_DEPTH 128 // Havuzdaki işçi görevlerin yığını (eski proses görevleriyle aynı)
+
+/**
+ * @brief Simüle edilen proseslere bağlanan, önceden yaratılmış FreeRTOS işçi görevleri havuzu.
+ *
+ * Gerçek zaman kipinde her geliş için xTaskCreate, her bitişte vTaskDelete yapmak yerine
+ * işçiler havuzdan alınır ve işleri bitince havuza geri döner. Boştaki işçiler görev
+ * bildirimi beklerken bloklu durur (bkz. vTaskGenericFunction); askıya alınmaları gerekmez.
+ * POSIX port'unda bir görev yaratmak pthread + koşul değişkeni + yığın ayırmak demek
+ * olduğundan, havuz ısındıktan sonra proses gelip gitmesi hiç iş parçacığı yaratmaz.
+ *
+ * Boşta bekleyen işçiler LIFO bir dizide tutulur (en son bırakılan, önbellekte en sıcak
+ * olan ilk verilir); dizi dolunca iki katına büyür.
+ */
+typedef struct {
+    TaskHandle_t* idle;      // Boştaki işçiler (ulTaskNotifyTake ile bildirim bekliyor)
+    int idleCount;           // Boştaki işçi sayısı
+    int idleCapacity;        // idle dizisinin kapasitesi
+    int size;                // Havuzun yarattığı toplam işçi (bağlı + boşta)
+    TaskHandle_t owner;      // İşçilerin quantum sonunu bildirdiği görev (controller)
+
+    unsigned long acquires;  // Toplam işçi isteği
+    unsigned long hits;      // Boştaki bir işçiyle karşılanan istekler
+} WorkerPool;
+
+/**
+ * @brief Havuzu hazırlar ve prewarm adet işçiyi önceden yaratır.
+ *
+ * FreeRTOS görevleri yarattığı için vTaskStartScheduler'dan önce ya da bir görev
+ * içinden çağrılabilir.
+ *
+ * @param owner İşçilere parametre olarak verilen, quantum sonu bildirimlerini alan görev
+ */
+void wpInit(WorkerPool* pool, int prewarm, TaskHandle_t owner);
+
+/**
+ * @brief Boştaki bir işçiyi verir; yoksa yenisini yaratır. Dönen işçi bildirim bekler.
+ */
+TaskHandle_t wpAcquire(WorkerPool* pool);
+
+/**
+ * @brief İşçiyi havuza geri verir (işçi bir sonraki bildirimi bekliyor olmalıdır).
+ */
+void wpRelease(WorkerPool* pool, TaskHandle_t worker);
+
+/**
+ * @brief İsteklerin boştaki işçiyle karşılanma oranı (0..1; hiç istek yoksa 0).
+ */
+double wpHitRate(const WorkerPool* pool);
+
+#endif
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "task_log.h"
+
+#define OUT_BUFFER_BYTES (1u << 20) // Çıkış tamponu; dolunca tek fwrite ile boşaltılır
+#define LINE_MAX_BYTES   256        // Tek log satırının üst sınırı
+
+/**
+ * @brief İkili olay logunu (--event-log) renkli log satırlarına çevirir.
+ *
+ * Satırlar simülatörün doğrudan bastığı satırlarla birebir aynıdır (formatTaskLog ortak);
+ * biçimlendirme maliyeti simülasyon sırasında değil, log okunurken ödenir.
+ * Sürüm 1 loglar (zamanlar tam saniye) de okunur; satırlar güncel biçimde basılır.
+ *
+ * Kullanım: event_decode <olay_logu>
+ */
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        printf("Kullanim: %s <olay_logu>\n", argv[0]);
+        return 1;
+    }
+
+    int fd = open(argv[1], O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        printf("Hata: %s dosyasi acilamadi.\n", argv[1]);
+        return 1;
+    }
+
+    // Hiç olay yazılmamışsa dosya boştur
+    size_t size = (size_t)st.st_size;
+    if (size == 0) {
+        return 0;
+    }
+
+    const uint8_t* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        printf("Hata: %s dosyasi bellege eslenemedi.\n", argv[1]);
+        return 1;
+    }
+    madvise((void*)data, size, MADV_SEQUENTIAL);
+    close(fd);
+
+    EventLogHeader header;
+    if (size < sizeof(header) || memcmp(data, EVENT_LOG_MAGIC, 8) != 0) {
+        printf("Hata: %s bir olay logu degil.\n", argv[1]);
+        return 1;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.version != EVENT_LOG_VERSION && header.version != EVENT_LOG_VERSION_SECONDS) {
+        printf("Hata: %s: desteklenmeyen olay logu surumu %u.\n", argv[1], header.version);
+        return 1;
+    }
+
+    char* buffer = malloc(OUT_BUFFER_BYTES);
+    if (buffer == NULL) {
+        printf("Hata: Bellek ayrilamadi.\n");
+        return 1;
+    }
+
+    const uint8_t* p = data + sizeof(header);
+    const uint8_t* end = data + size;
+    TaskLogRecord record;
+    unsigned long count = 0;
+    size_t used = 0;
+    SimTime prevTime = 0; // Önceki olayın dosyadaki (ölçeklenmemiş) zamanı
+
+    // Sürüm 1'de kayıt düzeni aynıdır, yalnızca zaman ve kalan süre tam saniyedir
+    SimTime unit = header.version == EVENT_LOG_VERSION_SECONDS ? SIM_TICKS_PER_SEC : 1;
+
+    memcpy(record.name, header.name, sizeof(record.name));
+    record.name[sizeof(record.name) - 1] = '\0';
+
+    while (p < end) {
+        if (!decodeTaskLog(&p, end, prevTime, &record)) {
+            fwrite(buffer, 1, used, stdout);
+            printf("Hata: %s: olay %lu kesik ya da bozuk.\n", argv[1], count + 1);
+            return 1;
+        }
+        prevTime = record.time;
+        record.time *= unit;
+        record.remainingTime *= unit;
+        count++;
+
+        if (used + LINE_MAX_BYTES > OUT_BUFFER_BYTES) {
+            fwrite(buffer, 1, used, stdout);
+            used = 0;
+        }
+        used += formatTaskLog(buffer + used, OUT_BUFFER_BYTES - used, &record);
+    }
+    fwrite(buffer, 1, used, stdout);
+
+    free(buffer);
+    munmap((void*)data, size);
+    return 0;
+}
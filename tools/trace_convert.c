@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "trace_loader.h"
+
+#define OUT_BUFFER_BYTES (1u << 20) // Çıkış tamponu; dolunca tek fwrite ile boşaltılır
+
+/**
+ * @brief Metin giriş dosyasını (giris.txt) ikili iz biçimine çevirir.
+ *
+ * Girdi trace_loader ile okunur; bu yüzden metin biçiminin tüm kuralları (BOM, CRLF,
+ * boş satırlar, satır numaralı hata) burada da geçerlidir. Kayıt sayısı baştan bilinmediği
+ * için başlık önce boş yazılır, dosya bitince başa dönülüp gerçek sayıyla yeniden yazılır.
+ *
+ * Kullanım: trace_convert <giris.txt> <cikis.bin>
+ */
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        printf("Kullanim: %s <giris.txt> <cikis.bin>\n", argv[0]);
+        return 1;
+    }
+
+    TraceReader reader;
+    trOpen(&reader, argv[1]);
+    if (reader.binary) {
+        printf("Hata: %s zaten ikili iz biciminde.\n", argv[1]);
+        return 1;
+    }
+
+    FILE* out = fopen(argv[2], "wb");
+    if (out == NULL) {
+        printf("Hata: %s dosyasi yazilamadi.\n", argv[2]);
+        return 1;
+    }
+
+    TraceBinHeader header;
+    TraceRecord record;
+    uint8_t* buffer = malloc(OUT_BUFFER_BYTES);
+    size_t used = 0;
+    uint64_t count = 0;
+    SimTime firstArrival = 0;
+    SimTime prevArrival = 0;
+
+    if (buffer == NULL) {
+        printf("Hata: Bellek ayrilamadi.\n");
+        return 1;
+    }
+
+    trInitBinHeader(&header, 0, 0);
+    fwrite(&header, sizeof(header), 1, out);
+
+    while (trNext(&reader, &record)) {
+        if (count == 0) {
+            firstArrival = prevArrival = record.arrivalTime;
+        }
+        if (used + TRACE_BIN_MAX_RECORD > OUT_BUFFER_BYTES) {
+            fwrite(buffer, 1, used, out);
+            used = 0;
+        }
+        used += trEncodeRecord(buffer + used, prevArrival, &record);
+        prevArrival = record.arrivalTime;
+        count++;
+    }
+    fwrite(buffer, 1, used, out);
+
+    trInitBinHeader(&header, count, firstArrival);
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+
+    if (fclose(out) != 0) {
+        printf("Hata: %s dosyasi yazilamadi.\n", argv[2]);
+        return 1;
+    }
+
+    printf("%llu kayit donusturuldu: %s -> %s\n", (unsigned long long)count, argv[1], argv[2]);
+    free(buffer);
+    trClose(&reader);
+    return 0;
+}